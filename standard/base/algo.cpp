@@ -1,5 +1,9 @@
 #include "algo.hpp"
 
+#include <chrono>
+#include <cstring>
+#include <random>
+
 namespace pycpp
 {
 
@@ -18,62 +22,87 @@ namespace pycpp
 			selected = __array[i];
 			location = upper_bound(__array, i, selected);
 
-			for (u32 j = i - 1u; j >= location; --j)
-				__array[j + 1] = __array[j];
+			for (u32 j = i; j > u32(location); --j)
+				__array[j] = __array[j - 1u];
 			__array[location] = selected;
 		}
 	}
 
-	void shell_sort(Object** __array, u32 len)
+#pragma endregion
+
+#pragma region Supported Hash
+
+	u64 hash_make_seed()
 	{
-		if (len <= 1)
-			return;
+#ifdef PYCPP_HASH_SEED
+		return u64(PYCPP_HASH_SEED);
+#else
+		std::random_device device;
+		u64 seed = (u64(device()) << 32u) ^ u64(device());
+
+		// "random_device" có thể là tất định trên một số nền tảng
+		seed ^= u64(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+		seed ^= u64(reinterpret_cast<uintptr_t>(&device));
+		return hash_multiply_fold(seed, 0x9E3779B97F4A7C15ull);
+#endif
+	}
 
-		// Tìm khoảng
-		u32 interval = 1u;
-		while (interval < len / 3)
-			interval = interval * 3 + 1;
+	static inline u64 hash_read_64(const u8* position)
+	{
+		u64 result;
+		std::memcpy(&result, position, 8u);
+		return result;
+	}
+
+	static inline u64 hash_read_32(const u8* position)
+	{
+		u32 result;
+		std::memcpy(&result, position, 4u);
+		return result;
+	}
 
-		// Shell
-		for (; interval > 1; interval = (interval - 1u) / 3u)
+	u64 hash_bytes(const void* data, u64 len)
+	{
+		constexpr const u64 SECRET_0 = 0xA0761D6478BD642Full;
+		constexpr const u64 SECRET_1 = 0xE7037ED1A0B428DBull;
+		constexpr const u64 SECRET_2 = 0x8EBC6AF09C88C6E3ull;
+
+		auto position = static_cast<const u8*>(data);
+		u64 seed = SECRET_0 ^ hash_multiply_fold(len ^ SECRET_1, SECRET_2);
+		u64 remaining = len;
+
+		// 16 byte mỗi vòng
+		for (; remaining > 16u; remaining -= 16u, position += 16u)
+			seed = hash_multiply_fold(hash_read_64(position) ^ SECRET_1, hash_read_64(position + 8u) ^ seed);
+
+		// 0 - 16 byte cuối : đọc chồng lên nhau thay vì từng byte
+		u64 a = 0u, b = 0u;
+		if (remaining > 8u)
+		{
+			a = hash_read_64(position);
+			b = hash_read_64(position + remaining - 8u);
+		}
+		else if (remaining >= 4u)
+		{
+			a = hash_read_32(position);
+			b = hash_read_32(position + remaining - 4u);
+		}
+		else if (remaining > 0u)
 		{
-			for (u32 outer = interval; outer < len; ++outer)
-			{
-				Object* value_to_insert = __array[outer];
-				u32 inner = outer;
-
-				// Move to right
-				while (inner >= interval && __array[inner - interval]->rich_compare(value_to_insert) > 0)
-				{
-					__array[inner] = __array[inner - interval];
-					inner -= interval;
-				}
-
-				__array[inner] = value_to_insert;
-			}
+			a = (u64(position[0]) << 16u) | (u64(position[remaining >> 1u]) << 8u) | position[remaining - 1u];
 		}
-		
-		// Insertion sort
-		binary_insertion_sort(__array, len);
+
+		return hash_multiply_fold(SECRET_1 ^ len, hash_multiply_fold(a ^ SECRET_1, b ^ seed));
 	}
 
-	u64 hash_array(Object** __array, u32 len)
+	u64 hash_array(Object** __array, u32 len, HashPolicy policy)
 	{
-		u64 base = 0b1110'1101'1011'0111ull;
-
 		if (len == 0u)
-			return base;
+			return HASH_ARRAY_BASE;
 
 		u64 hash_value = 0u;
-		u64 seed, hash_item;
 		for (u32 i = 0; i < len; ++i)
-		{
-			seed = hash_value;
-			hash_item = __array[i]->hash();
-
-			seed ^= hash_item + base + (seed >> 2);
-			hash_value = seed;
-		}
+			hash_value = hash_array_combine(hash_value, hash_finalize(__array[i]->hash(), policy));
 
 		return hash_value;
 	}
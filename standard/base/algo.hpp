@@ -2,9 +2,24 @@
 
 #include "object.hpp"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace pycpp
 {
 
+#pragma region Macro
+
+	// Hàm băm trộn mặc định của HashTable, OrderedMap và "hash_array" ( xem HashPolicy ).
+#ifndef PYCPP_HASH_POLICY
+#define PYCPP_HASH_POLICY HashPolicy::Mix
+#endif
+
+	// Định nghĩa PYCPP_HASH_SEED ( u64 ) để cố định khóa của HashPolicy::Seeded giữa các lần chạy.
+
+#pragma endregion
+
 #pragma region Supported Basic Algorith
 
 	template <typename T>
@@ -41,6 +56,21 @@ namespace pycpp
 		return n + 1u;
 	}
 
+	/// <summary>
+	/// Trả về vị trí bit 1 thấp nhất của "n".
+	/// (!) : "n" phải khác 0.
+	/// </summary>
+	inline u32 count_trailing_zeros(u32 n)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, n);
+		return u32(index);
+#else
+		return u32(__builtin_ctz(n));
+#endif
+	}
+
 #pragma endregion
 
 #pragma region Supported Array
@@ -80,9 +110,90 @@ namespace pycpp
 
 	void binary_insertion_sort(Object** __array, u32 len);
 
-	void shell_sort(Object** __array, u32 len);
+#pragma endregion
+
+#pragma region Supported Hash
+
+	/*
+	HashPolicy : cách trộn hash của Object trước khi tính vị trí trong bảng băm.
+
+	- "hash" của I32 / I64 là chính giá trị, của Object là địa chỉ ( các bit thấp luôn bằng 0 ) :
+	  dùng trực tiếp làm vị trí thì các khóa liên tiếp dồn vào cùng vùng của bảng.
+	- Bảng băm lưu "hash" gốc của Object, chỉ trộn khi dò, nên có thể sao chép hash giữa các bảng khác chính sách.
+	*/
+	enum class HashPolicy : uint8_t
+	{
+		// Dùng nguyên "hash" của Object ( tương thích với phiên bản cũ ).
+		Identity = 0,
+
+		// Trộn kiểu wyhash : nhân 128 bit với hằng số rồi gộp nửa cao và nửa thấp.
+		Mix,
+
+		// Như Mix nhưng với khóa ngẫu nhiên của tiến trình, chống các khóa được chọn để va chạm.
+		Seeded
+	};
+
+	// Tạo khóa ngẫu nhiên cho HashPolicy::Seeded.
+	u64 hash_make_seed();
+
+	// Khóa của HashPolicy::Seeded, cố định trong suốt tiến trình.
+	inline u64 hash_seed()
+	{
+		static const u64 seed = hash_make_seed();
+		return seed;
+	}
+
+	// Nhân 128 bit, trả về nửa cao XOR nửa thấp.
+	inline u64 hash_multiply_fold(u64 a, u64 b)
+	{
+#if defined(_MSC_VER) && defined(_M_X64)
+		u64 high;
+		u64 low = _umul128(a, b, &high);
+		return high ^ low;
+#elif defined(__SIZEOF_INT128__)
+		unsigned __int128 product = (unsigned __int128)a * b;
+		return u64(product >> 64u) ^ u64(product);
+#else
+		// Nhân từng nửa 32 bit
+		u64 a_low = a & 0xFFFFFFFFull, a_high = a >> 32u;
+		u64 b_low = b & 0xFFFFFFFFull, b_high = b >> 32u;
+		u64 low_low = a_low * b_low, low_high = a_low * b_high;
+		u64 high_low = a_high * b_low, high_high = a_high * b_high;
+		u64 middle = (low_low >> 32u) + (low_high & 0xFFFFFFFFull) + (high_low & 0xFFFFFFFFull);
+		u64 high = high_high + (low_high >> 32u) + (high_low >> 32u) + (middle >> 32u);
+		u64 low = (middle << 32u) | (low_low & 0xFFFFFFFFull);
+		return high ^ low;
+#endif
+	}
+
+	// Trộn "hash_value" theo "policy".
+	inline u64 hash_finalize(u64 hash_value, HashPolicy policy)
+	{
+		switch (policy)
+		{
+		case HashPolicy::Identity:
+			return hash_value;
+		case HashPolicy::Mix:
+			return hash_multiply_fold(hash_value ^ 0xA0761D6478BD642Full, 0xE7037ED1A0B428DBull);
+		default:
+			return hash_multiply_fold(hash_value ^ hash_seed(), 0xE7037ED1A0B428DBull);
+		}
+	}
+
+	// Hash của dãy byte, đọc 8 byte một lần ( kiểu wyhash ), không phụ thuộc HashPolicy.
+	u64 hash_bytes(const void* data, u64 len);
+
+	// Hash của dãy rỗng.
+	constexpr const u64 HASH_ARRAY_BASE = 0b1110'1101'1011'0111ull;
+
+	// Gộp "hash_item" ( đã trộn ) vào hash của dãy, dùng chung bởi "hash_array" và các mảng không đóng hộp.
+	inline u64 hash_array_combine(u64 hash_value, u64 hash_item)
+	{
+		return hash_value ^ (hash_item + HASH_ARRAY_BASE + (hash_value << 6) + (hash_value >> 2));
+	}
 
-	u64 hash_array(Object** __array, u32 len);
+	// Hash của dãy Object ( phụ thuộc thứ tự ), mỗi hash phần tử được trộn theo "policy" trước khi gộp.
+	u64 hash_array(Object** __array, u32 len, HashPolicy policy = PYCPP_HASH_POLICY);
 
 #pragma endregion
 
@@ -0,0 +1,165 @@
+#include "allocator.hpp"
+
+#include <mutex>
+
+namespace pycpp
+{
+
+#pragma region Definition : Chunk
+
+	__ChunkHeader* __chunk_allocate(u32 kind)
+	{
+		auto memory = ::operator new(PYCPP_SLAB_SIZE, std::align_val_t(PYCPP_SLAB_SIZE));
+		return new (memory) __ChunkHeader(kind);
+	}
+
+	void __chunk_free(__ChunkHeader* chunk)
+	{
+		chunk->~__ChunkHeader();
+		::operator delete(static_cast<void*>(chunk), std::align_val_t(PYCPP_SLAB_SIZE));
+	}
+
+#pragma endregion
+
+#pragma region Definition : Slab Pool
+
+	// Kho chung chứa các khối bị bỏ lại, mỗi size class một danh sách.
+	// Số size class tối đa : PYCPP_SLAB_SIZE / 16.
+	struct __SlabOrphans
+	{
+		std::mutex lock;
+		__SlabBlock* lists[PYCPP_SLAB_SIZE / 16u] = { nullptr };
+	};
+
+	static __SlabOrphans& slab_orphans()
+	{
+		// Khởi tạo khi sử dụng lần đầu : thread_local của các thread khác có thể hủy sau biến tĩnh.
+		static __SlabOrphans* orphans = new __SlabOrphans();
+		return *orphans;
+	}
+
+	__SlabBlock* __slab_take_orphans(u32 block_size)
+	{
+		auto& orphans = slab_orphans();
+		std::lock_guard<std::mutex> guard(orphans.lock);
+
+		auto& head = orphans.lists[block_size >> 4u];
+		auto result = head;
+		head = nullptr;
+		return result;
+	}
+
+	void __slab_give_orphans(u32 block_size, __SlabBlock* head, __SlabBlock* tail)
+	{
+		auto& orphans = slab_orphans();
+		std::lock_guard<std::mutex> guard(orphans.lock);
+
+		auto& list = orphans.lists[block_size >> 4u];
+		tail->next = list;
+		list = head;
+	}
+
+	// Danh sách các __SlabLocalCache của thread hiện tại.
+	static thread_local __SlabLocalCache* slab_thread_caches = nullptr;
+
+	__SlabLocalCache::__SlabLocalCache(u32 block_size) :
+		block_size(block_size), next_cache(slab_thread_caches)
+	{
+		slab_thread_caches = this;
+	}
+
+	__SlabLocalCache::~__SlabLocalCache()
+	{
+		flush();
+
+		// thread_local bị hủy theo thứ tự ngược với khởi tạo : "this" là đầu danh sách
+		if (slab_thread_caches == this)
+			slab_thread_caches = next_cache;
+	}
+
+	void __SlabLocalCache::flush()
+	{
+		if (free_list == nullptr)
+			return;
+
+		auto tail = free_list;
+		while (tail->next)
+			tail = tail->next;
+		__slab_give_orphans(block_size, free_list, tail);
+		free_list = nullptr;
+	}
+
+	void slab_flush_thread_cache()
+	{
+		for (auto cache = slab_thread_caches; cache; cache = cache->next_cache)
+			cache->flush();
+	}
+
+	__SlabBlock* __slab_allocate_slab(u32 block_size)
+	{
+		u32 number_of_blocks = (PYCPP_SLAB_SIZE - CHUNK_HEADER_SIZE) / block_size;
+		auto slab = reinterpret_cast<unsigned char*>(__chunk_allocate(CHUNK_SLAB)) + CHUNK_HEADER_SIZE;
+
+		// Nối các khối thành danh sách tự do
+		__SlabBlock* head = nullptr;
+		for (u32 i = number_of_blocks; i > 0u; --i)
+		{
+			auto block = reinterpret_cast<__SlabBlock*>(slab + std::size_t(i - 1u) * block_size);
+			block->next = head;
+			head = block;
+		}
+
+		return head;
+	}
+
+#pragma endregion
+
+#pragma region Definition : Arena
+
+	void* __Arena::allocate_slow(u32 size)
+	{
+		auto chunk = __chunk_allocate(CHUNK_ARENA);
+		chunk->next = chunks;
+		chunks = chunk;
+
+		cursor = reinterpret_cast<unsigned char*>(chunk) + CHUNK_HEADER_SIZE;
+		end = reinterpret_cast<unsigned char*>(chunk) + PYCPP_SLAB_SIZE;
+
+		auto result = cursor;
+		cursor += size;
+		++chunk->allocated;
+		return result;
+	}
+
+	ArenaScope::ArenaScope()
+	{
+		arena.previous = __arena_current;
+		__arena_current = &arena;
+	}
+
+	ArenaScope::~ArenaScope()
+	{
+		__arena_current = arena.previous;
+
+		// Kết thúc từng chunk : giải phóng ngay nếu không còn khối sống, nếu không thì chunk bị ghim
+		for (auto chunk = arena.chunks; chunk;)
+		{
+			auto next = chunk->next;
+			u32 added = (chunk->allocated << 1u) | 1u;
+			if (chunk->state.fetch_add(added, std::memory_order_acq_rel) + added == 1u)
+				__chunk_free(chunk);
+			chunk = next;
+		}
+	}
+
+	u32 ArenaScope::chunks() const
+	{
+		u32 result = 0u;
+		for (auto chunk = arena.chunks; chunk; chunk = chunk->next)
+			++result;
+		return result;
+	}
+
+#pragma endregion
+
+}
\ No newline at end of file
@@ -0,0 +1,291 @@
+#pragma once
+
+#include "object.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace pycpp
+{
+
+#pragma region Macro
+
+	// Kích thước mỗi slab ( bytes ) được cấp phát khi danh sách khối tự do của một thread bị rỗng.
+	// Slab và chunk của Arena được căn theo kích thước này ( phải là lũy thừa của 2 ).
+#ifndef PYCPP_SLAB_SIZE
+#define PYCPP_SLAB_SIZE (64u * 1024u)
+#endif
+
+	static_assert((PYCPP_SLAB_SIZE & (PYCPP_SLAB_SIZE - 1u)) == 0u, "PYCPP_SLAB_SIZE must be a power of two");
+
+	// Dung lượng mới ( số ô ) tối thiểu để băm lại tăng dần, bảng nhỏ hơn được băm lại một lần.
+#ifndef PYCPP_INCREMENTAL_REHASH_CAPACITY
+#define PYCPP_INCREMENTAL_REHASH_CAPACITY 65536u
+#endif
+
+	// Số ô ( phần tử với OrderedMap ) của bảng cũ được chuyển sang bảng mới sau mỗi lần thay đổi / tìm kiếm.
+	// Tối thiểu 2 để bảng cũ được chuyển hết trước khi bảng mới đầy.
+#ifndef PYCPP_REHASH_STEP
+#define PYCPP_REHASH_STEP 64u
+#endif
+
+	static_assert(PYCPP_REHASH_STEP >= 2u, "PYCPP_REHASH_STEP must be at least 2");
+
+#pragma endregion
+
+#pragma region Declaration : Chunk
+
+	// Loại của chunk ( slab hoặc chunk của Arena ).
+	constexpr const u32 CHUNK_SLAB = 1u;
+	constexpr const u32 CHUNK_ARENA = 2u;
+
+	// Header ở đầu mỗi chunk PYCPP_SLAB_SIZE bytes ( căn theo PYCPP_SLAB_SIZE ),
+	// địa chỉ của chunk chứa một khối được tính bằng phép AND ( "__chunk_of" ).
+	struct alignas(16) __ChunkHeader
+	{
+		u32 kind;
+
+		// Arena : số khối đã cấp phát trong chunk ( chỉ thread sở hữu Arena ghi ).
+		u32 allocated;
+
+		// Arena : -2 x số khối đã giải phóng, cộng "2 x allocated | 1" khi Arena kết thúc.
+		// Chunk được giải phóng khi giá trị bằng 1 ( đã kết thúc và không còn khối sống ).
+		std::atomic<u32> state;
+
+		// Arena : chunk tiếp theo của cùng Arena.
+		__ChunkHeader* next;
+
+		inline explicit __ChunkHeader(u32 kind) : kind(kind), allocated(0u), state(0u), next(nullptr) {}
+	};
+
+	constexpr const u32 CHUNK_HEADER_SIZE = u32(sizeof(__ChunkHeader));
+
+	inline __ChunkHeader* __chunk_of(void* pointer)
+	{
+		return reinterpret_cast<__ChunkHeader*>(std::uintptr_t(pointer) & ~std::uintptr_t(PYCPP_SLAB_SIZE - 1u));
+	}
+
+	// Cấp phát một chunk PYCPP_SLAB_SIZE bytes căn theo PYCPP_SLAB_SIZE.
+	__ChunkHeader* __chunk_allocate(u32 kind);
+
+	void __chunk_free(__ChunkHeader* chunk);
+
+#pragma endregion
+
+#pragma region Declaration : Slab Pool
+
+	/*
+	Slab Pool : bộ cấp phát theo kích thước lớp ( size class ) cho các Object nhỏ được tạo / hủy liên tục.
+
+	- Mỗi size class ( bội số của 16 bytes ) có một danh sách khối tự do riêng cho từng thread,
+	  cấp phát và giải phóng chỉ là thao tác trên danh sách liên kết, không cần khóa.
+	- Khi danh sách rỗng, lấy lại các khối bị bỏ lại bởi thread đã kết thúc, nếu không có thì cấp phát slab mới.
+	- Slab không được trả lại cho hệ điều hành : bộ nhớ được tái sử dụng cho cùng size class.
+	- Khối được giải phóng ở thread khác với thread cấp phát sẽ thuộc về thread giải phóng.
+	*/
+
+	struct __SlabBlock
+	{
+		__SlabBlock* next;
+	};
+
+	// Danh sách khối tự do của một size class trong một thread.
+	// Các danh sách của cùng thread được nối với nhau để "slab_flush_thread_cache" duyệt.
+	struct __SlabLocalCache
+	{
+		__SlabBlock* free_list = nullptr;
+		u32 block_size;
+		__SlabLocalCache* next_cache;
+
+		explicit __SlabLocalCache(u32 block_size);
+		~__SlabLocalCache();
+
+		// Trả toàn bộ khối tự do về kho chung.
+		void flush();
+	};
+
+	// Làm tròn "size" lên bội số của 16 bytes.
+	constexpr inline u32 slab_size_class(std::size_t size)
+	{
+		return u32((size + 15u) & ~std::size_t(15u));
+	}
+
+	// Lấy toàn bộ khối bị bỏ lại của size class "block_size", trả về nullptr nếu không có.
+	__SlabBlock* __slab_take_orphans(u32 block_size);
+
+	// Trả danh sách khối [head, tail] của thread sắp kết thúc về kho chung.
+	void __slab_give_orphans(u32 block_size, __SlabBlock* head, __SlabBlock* tail);
+
+	// Cấp phát một slab mới và chia thành các khối "block_size", trả về khối đầu tiên.
+	__SlabBlock* __slab_allocate_slab(u32 block_size);
+
+	// Trả toàn bộ khối tự do của thread hiện tại về kho chung để các thread khác tái sử dụng.
+	// Dùng cho thread chỉ giải phóng mà không cấp phát ( ví dụ thread giải phóng nền ).
+	void slab_flush_thread_cache();
+
+	template <u32 BlockSize>
+	class __SlabPool final
+	{
+		static_assert(BlockSize % 16u == 0u, "BlockSize must be a size class");
+		static_assert(BlockSize + CHUNK_HEADER_SIZE <= PYCPP_SLAB_SIZE, "BlockSize must fit in a slab");
+
+		static inline thread_local __SlabLocalCache local{ BlockSize };
+
+	public:
+		static inline void* allocate()
+		{
+			auto block = local.free_list;
+			if (block == nullptr)
+			{
+				block = __slab_take_orphans(BlockSize);
+				if (block == nullptr)
+					block = __slab_allocate_slab(BlockSize);
+			}
+
+			local.free_list = block->next;
+			return block;
+		}
+
+		static inline void deallocate(void* pointer)
+		{
+			auto block = static_cast<__SlabBlock*>(pointer);
+			block->next = local.free_list;
+			local.free_list = block;
+		}
+	};
+
+	template <typename T>
+	using __SlabPoolOf = __SlabPool<slab_size_class(sizeof(T))>;
+
+#pragma endregion
+
+#pragma region Declaration : Arena
+
+	/*
+	Arena : bộ cấp phát tăng dần ( bump allocator ) cho đồ thị Object ngắn hạn, sử dụng qua ArenaScope.
+
+	- Khi ArenaScope hoạt động, các lớp dùng SLAB_ALLOCATOR ( I32, I64, F32, F64, Str, Pair, Tuple, ... )
+	  được cấp phát từ Arena của thread hiện tại thay vì Slab Pool.
+	- Giải phóng Object ( SAFE / DECREF ) vẫn gọi hàm hủy nhưng chỉ giảm bộ đếm của chunk, bộ nhớ không được tái sử dụng.
+	- Khi ArenaScope kết thúc, mọi chunk không còn khối sống được giải phóng cùng lúc ( O(số chunk) ).
+	- Object thoát khỏi scope ( vẫn còn được tham chiếu ) được giữ nguyên địa chỉ : chunk chứa nó bị ghim ( pinned )
+	  và chỉ được giải phóng khi khối cuối cùng của chunk được giải phóng, ở bất kỳ thread nào.
+	*/
+
+	class __Arena final
+	{
+		__ChunkHeader* chunks = nullptr;
+		unsigned char* cursor = nullptr;
+		unsigned char* end = nullptr;
+		__Arena* previous = nullptr;
+
+		friend class ArenaScope;
+
+		void* allocate_slow(u32 size);
+
+	public:
+		inline void* allocate(u32 size)
+		{
+			if (size > u32(end - cursor))
+				return allocate_slow(size);
+
+			auto result = cursor;
+			cursor += size;
+			++chunks->allocated;
+			return result;
+		}
+	};
+
+	// Arena đang hoạt động của thread hiện tại, nullptr nếu không có ArenaScope nào.
+	inline thread_local __Arena* __arena_current = nullptr;
+
+	// Giải phóng một khối thuộc chunk của Arena.
+	inline void __arena_deallocate(__ChunkHeader* chunk)
+	{
+		// Arena đã kết thúc và đây là khối sống cuối cùng
+		if (chunk->state.fetch_sub(2u, std::memory_order_acq_rel) == 3u)
+			__chunk_free(chunk);
+	}
+
+	/*
+	ArenaScope : trong phạm vi của đối tượng ( RAII ), Object nhỏ được cấp phát từ một Arena mới.
+
+	{
+		ArenaScope scope;
+		... tạo và giải phóng các Object tạm ...
+	}	// giải phóng toàn bộ chunk cùng lúc
+
+	- ArenaScope có thể lồng nhau, Arena trong cùng được sử dụng.
+	(!) : chỉ tạo ArenaScope trên stack, hủy theo thứ tự ngược với khởi tạo trên cùng thread.
+	(!) : Object tạm chưa được SAFE khi scope kết thúc vẫn giữ chunk của nó ( giống như rò rỉ khi không dùng Arena ).
+	*/
+	class ArenaScope final
+	{
+		__Arena arena;
+
+	public:
+		ArenaScope();
+		~ArenaScope();
+
+		ArenaScope(const ArenaScope&) = delete;
+		ArenaScope& operator=(const ArenaScope&) = delete;
+
+		// Số chunk đã cấp phát cho Arena.
+		u32 chunks() const;
+	};
+
+	// Cấp phát cho lớp "T" : từ Arena nếu có ArenaScope đang hoạt động, nếu không thì từ Slab Pool.
+	template <typename T>
+	inline void* __pool_allocate()
+	{
+		auto arena = __arena_current;
+		if (arena != nullptr)
+			return arena->allocate(slab_size_class(sizeof(T)));
+		return __SlabPoolOf<T>::allocate();
+	}
+
+	template <typename T>
+	inline void __pool_deallocate(void* pointer)
+	{
+		auto chunk = __chunk_of(pointer);
+		if (chunk->kind == CHUNK_ARENA)
+			__arena_deallocate(chunk);
+		else
+			__SlabPoolOf<T>::deallocate(pointer);
+	}
+
+#pragma endregion
+
+#pragma region Macro
+
+	// Khai báo operator new / delete của lớp "Type" dựa trên Slab Pool ( hoặc Arena, xem ArenaScope ).
+	// (!) : chỉ sử dụng cho lớp "final", kích thước cấp phát luôn là sizeof(Type).
+	// (!) : định nghĩa macro "PYCPP_DISABLE_SLAB_ALLOCATOR" để sử dụng new / delete mặc định.
+#ifndef PYCPP_DISABLE_SLAB_ALLOCATOR
+
+#define SLAB_ALLOCATOR(Type)	\
+	static void* operator new(std::size_t)	\
+	{	\
+		return pycpp::__pool_allocate<Type>();	\
+	}	\
+	static void operator delete(void* pointer)	\
+	{	\
+		pycpp::__pool_deallocate<Type>(pointer);	\
+	}	\
+	static void* operator new(std::size_t, void* place) noexcept	\
+	{	\
+		return place;	\
+	}	\
+	static void operator delete(void*, void*) noexcept {}
+
+#else
+
+#define SLAB_ALLOCATOR(Type)
+
+#endif
+
+#pragma endregion
+
+}
\ No newline at end of file
@@ -0,0 +1,334 @@
+#include "collector.hpp"
+#include "algo.hpp"
+#include "var.hpp"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pycpp
+{
+
+#pragma region Definition : Cycle Collector State
+
+	struct __GCEntry
+	{
+		Object* object;
+		__GCNode* node;
+	};
+
+	struct __GCState
+	{
+		std::mutex lock;
+		std::vector<__GCEntry> generations[PYCPP_GC_GENERATIONS];
+
+		// counts[0] : số Object được theo dõi ( trừ số Object bỏ theo dõi ) từ lần thu gom thế hệ 0 gần nhất.
+		// counts[i] : số lần thu gom thế hệ "i - 1" từ lần thu gom thế hệ "i" gần nhất.
+		u32 counts[PYCPP_GC_GENERATIONS] = {};
+		u32 thresholds[PYCPP_GC_GENERATIONS] = { PYCPP_GC_THRESHOLD, 10u, 10u };
+
+		// Vị trí bắt đầu của lần thu gom tăng dần tiếp theo trong thế hệ già.
+		u32 cursor = 0u;
+		u32 increment = PYCPP_GC_INCREMENT;
+
+		bool enabled = PYCPP_GC_AUTOMATIC;
+		bool collecting = false;
+	};
+
+	static __GCState& gc_state()
+	{
+		// Không bao giờ hủy : container tĩnh có thể được hủy sau biến tĩnh khác.
+		static __GCState* state = new __GCState();
+		return *state;
+	}
+
+	static constexpr const u32 GC_OLDEST = PYCPP_GC_GENERATIONS - 1u;
+
+	static inline void gc_append(__GCState& state, u32 generation, Object* object, __GCNode* node)
+	{
+		auto& list = state.generations[generation];
+		node->slot = u32(list.size());
+		node->generation = u8(generation);
+		list.push_back({ object, node });
+	}
+
+#pragma endregion
+
+#pragma region Definition : Trial Deletion
+
+	struct __GCInfo
+	{
+		// Số tham chiếu từ bên ngoài tập kiểm tra.
+		i64 refs;
+		bool reachable;
+	};
+
+	struct __GCContext
+	{
+		std::unordered_map<Object*, __GCInfo> candidates;
+		std::vector<Object*> pending;
+	};
+
+	// Thêm Object vào tập kiểm tra, trả về false nếu đã có hoặc luôn được giữ lại.
+	static bool gc_add_candidate(__GCContext& context, Object* object)
+	{
+		auto count = object->ref_count.load();
+		if (count == 0u || object->ref_count.is_immortal())
+			return false;
+
+		return context.candidates.emplace(object, __GCInfo{ i64(count), false }).second;
+	}
+
+	static void gc_visit_closure(Object* child, void* context)
+	{
+		auto gc_context = static_cast<__GCContext*>(context);
+		if (child != nullptr && child->is_tracked() && gc_add_candidate(*gc_context, child))
+			gc_context->pending.push_back(child);
+	}
+
+	static void gc_visit_decrement(Object* child, void* context)
+	{
+		auto gc_context = static_cast<__GCContext*>(context);
+		auto found = gc_context->candidates.find(child);
+		if (found != gc_context->candidates.end())
+			--found->second.refs;
+	}
+
+	static void gc_visit_reachable(Object* child, void* context)
+	{
+		auto gc_context = static_cast<__GCContext*>(context);
+		auto found = gc_context->candidates.find(child);
+		if (found != gc_context->candidates.end() && !found->second.reachable)
+		{
+			found->second.reachable = true;
+			gc_context->pending.push_back(child);
+		}
+	}
+
+	// Tìm rác trong các thế hệ từ 0 đến "top" ( cùng một phần thế hệ già nếu "incremental" ).
+	// Object của các thế hệ được kiểm tra ( kể cả rác ) được chuyển lên thế hệ tiếp theo.
+	// (!) : gọi khi đang giữ khóa.
+	static std::vector<Object*> gc_find_garbage(__GCState& state, u32 top, bool incremental)
+	{
+		u32 target = top < GC_OLDEST ? top + 1u : GC_OLDEST;
+
+		std::vector<__GCEntry> young;
+		for (u32 generation = 0u; generation <= top; ++generation)
+		{
+			auto& list = state.generations[generation];
+			young.insert(young.end(), list.begin(), list.end());
+			list.clear();
+		}
+
+		__GCContext context;
+		context.candidates.reserve(young.size());
+		for (auto& entry : young)
+			gc_add_candidate(context, entry.object);
+
+		// Một phần thế hệ già cùng các Object được theo dõi mà nó với tới ( để chu trình nằm trọn trong tập )
+		if (incremental)
+		{
+			auto& old = state.generations[GC_OLDEST];
+			if (state.cursor >= old.size())
+				state.cursor = 0u;
+
+			u32 end = pycpp::min(u32(old.size()), state.cursor + state.increment);
+			for (u32 i = state.cursor; i < end; ++i)
+				if (gc_add_candidate(context, old[i].object))
+					context.pending.push_back(old[i].object);
+			state.cursor = end;
+
+			while (!context.pending.empty())
+			{
+				auto current = context.pending.back();
+				context.pending.pop_back();
+				current->traverse(gc_visit_closure, &context);
+			}
+		}
+
+		// Trừ các tham chiếu từ bên trong tập
+		for (auto& candidate : context.candidates)
+			candidate.first->traverse(gc_visit_decrement, &context);
+
+		// Object còn tham chiếu từ bên ngoài và mọi Object nó với tới
+		for (auto& candidate : context.candidates)
+			if (candidate.second.refs > 0)
+			{
+				candidate.second.reachable = true;
+				context.pending.push_back(candidate.first);
+			}
+
+		while (!context.pending.empty())
+		{
+			auto current = context.pending.back();
+			context.pending.pop_back();
+			current->traverse(gc_visit_reachable, &context);
+		}
+
+		std::vector<Object*> garbage;
+		for (auto& candidate : context.candidates)
+			if (!candidate.second.reachable)
+				garbage.push_back(candidate.first);
+
+		for (auto& entry : young)
+			gc_append(state, target, entry.object, entry.node);
+
+		return garbage;
+	}
+
+	// Phá chu trình : giữ toàn bộ rác trong lúc bỏ tham chiếu tới Object con, sau đó giải phóng.
+	static void gc_release(const std::vector<Object*>& garbage)
+	{
+		for (auto object : garbage)
+			INREF(object);
+
+		for (auto object : garbage)
+			object->clear_references();
+
+		for (auto object : garbage)
+			DECREF(object);
+	}
+
+	// Thu gom các thế hệ từ 0 đến "top", giải phóng rác sau khi mở khóa.
+	// (!) : gọi khi đang giữ khóa và bộ thu gom không chạy.
+	static u32 gc_run(__GCState& state, std::unique_lock<std::mutex>& guard, u32 top, bool incremental)
+	{
+		state.collecting = true;
+		auto garbage = gc_find_garbage(state, top, incremental);
+
+		u32 last = incremental ? GC_OLDEST : top;
+		for (u32 generation = 0u; generation <= last; ++generation)
+			state.counts[generation] = 0u;
+		if (last < GC_OLDEST)
+			++state.counts[last + 1u];
+
+		guard.unlock();
+		gc_release(garbage);
+		guard.lock();
+
+		state.collecting = false;
+		return u32(garbage.size());
+	}
+
+	// Chọn thế hệ cần thu gom theo ngưỡng.
+	static void gc_collect_automatic(__GCState& state, std::unique_lock<std::mutex>& guard)
+	{
+		u32 top = 0u;
+		while (top + 1u < GC_OLDEST && state.counts[top + 1u] >= state.thresholds[top + 1u])
+			++top;
+
+		bool incremental = top + 1u == GC_OLDEST && state.counts[GC_OLDEST] >= state.thresholds[GC_OLDEST];
+		gc_run(state, guard, top, incremental);
+	}
+
+#pragma endregion
+
+#pragma region Definition : Cycle Collector
+
+	void gc_track(Object* object, __GCNode& node)
+	{
+		auto& state = gc_state();
+		std::unique_lock<std::mutex> guard(state.lock);
+		if (node.tracked)
+			return;
+
+		if (state.enabled && !state.collecting && state.thresholds[0] != 0u && state.counts[0] >= state.thresholds[0])
+			gc_collect_automatic(state, guard);
+
+		gc_append(state, 0u, object, &node);
+		node.tracked = true;
+		object->__flags |= Object::OBJECT_TRACKED;
+		++state.counts[0];
+	}
+
+	void gc_untrack(__GCNode& node)
+	{
+		auto& state = gc_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+		if (!node.tracked)
+			return;
+
+		auto& list = state.generations[node.generation];
+		auto& entry = list[node.slot];
+		entry.object->__flags &= u8(~Object::OBJECT_TRACKED);
+
+		entry = list.back();
+		entry.node->slot = node.slot;
+		list.pop_back();
+
+		node.tracked = false;
+		if (state.counts[0] != 0u)
+			--state.counts[0];
+	}
+
+	u32 gc_collect(u32 generation)
+	{
+		auto& state = gc_state();
+		std::unique_lock<std::mutex> guard(state.lock);
+		if (state.collecting)
+			return 0u;
+
+		if (generation > GC_OLDEST)
+			generation = GC_OLDEST;
+		if (generation == GC_OLDEST)
+			state.cursor = 0u;
+		return gc_run(state, guard, generation, false);
+	}
+
+	u32 gc_collect_increment()
+	{
+		auto& state = gc_state();
+		std::unique_lock<std::mutex> guard(state.lock);
+		if (state.collecting)
+			return 0u;
+
+		return gc_run(state, guard, GC_OLDEST - 1u, true);
+	}
+
+	void gc_enable()
+	{
+		auto& state = gc_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+		state.enabled = true;
+	}
+
+	void gc_disable()
+	{
+		auto& state = gc_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+		state.enabled = false;
+	}
+
+	bool gc_is_enabled()
+	{
+		auto& state = gc_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+		return state.enabled;
+	}
+
+	void gc_set_threshold(u32 threshold0, u32 threshold1, u32 threshold2)
+	{
+		auto& state = gc_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+		state.thresholds[0] = threshold0;
+		state.thresholds[1] = threshold1;
+		state.thresholds[2] = threshold2;
+	}
+
+	void gc_set_increment(u32 increment)
+	{
+		auto& state = gc_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+		state.increment = increment != 0u ? increment : 1u;
+	}
+
+	u32 gc_tracked_count(u32 generation)
+	{
+		auto& state = gc_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+		return generation < PYCPP_GC_GENERATIONS ? u32(state.generations[generation].size()) : 0u;
+	}
+
+#pragma endregion
+
+}
\ No newline at end of file
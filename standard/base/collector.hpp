@@ -0,0 +1,109 @@
+#pragma once
+
+#include "object.hpp"
+
+namespace pycpp
+{
+
+#pragma region Macro
+
+	// Số thế hệ của bộ thu gom chu trình, thế hệ cuối cùng là thế hệ già.
+#define PYCPP_GC_GENERATIONS 3u
+
+	// Số Object được theo dõi ( tạo mới - giải phóng ) trước khi thu gom thế hệ 0.
+#ifndef PYCPP_GC_THRESHOLD
+#define PYCPP_GC_THRESHOLD 700u
+#endif
+
+	// Số Object của thế hệ già được kiểm tra trong mỗi lần thu gom tăng dần.
+#ifndef PYCPP_GC_INCREMENT
+#define PYCPP_GC_INCREMENT 2000u
+#endif
+
+	// Bật thu gom tự động, mặc định chỉ bật với PYCPP_REFCOUNT_PLAIN ( một thread ).
+#ifndef PYCPP_GC_AUTOMATIC
+#define PYCPP_GC_AUTOMATIC (PYCPP_REFCOUNT_MODE == PYCPP_REFCOUNT_PLAIN)
+#endif
+
+#pragma endregion
+
+#pragma region Declaration : Cycle Collector
+
+	/*
+	Cycle Collector : thu gom các chu trình tham chiếu mà bộ đếm tham chiếu không thể giải phóng
+	( ArrayList chứa chính nó, giá trị của OrderedMap tham chiếu tới OrderedMap ... ).
+
+	- Các container ( ArrayList, Tuple, Deque, HashTable, OrderedMap, FixedArray ) được theo dõi từ khi tạo
+	  đến khi hủy qua thành viên "__GCNode". Pair và View chỉ được theo dõi khi tham chiếu tới Object được theo dõi.
+	- Thuật toán xóa thử ( trial deletion ) : với mỗi Object trong tập kiểm tra, lấy số tham chiếu trừ đi
+	  các tham chiếu từ bên trong tập ( qua "traverse" ). Object còn tham chiếu từ bên ngoài và mọi Object
+	  nó với tới được giữ lại, phần còn lại là rác và được phá chu trình bằng "clear_references".
+	- Object có số tham chiếu bằng 0 ( Object tạm, đang khởi tạo / đang hủy ) hoặc bất tử luôn được giữ lại
+	  và không bị duyệt.
+	- Thế hệ : Object sống sót sau một lần thu gom được chuyển lên thế hệ tiếp theo.
+	  Thế hệ 0 được thu gom sau mỗi "threshold0" Object được theo dõi, thế hệ 1 sau mỗi "threshold1" lần
+	  thu gom thế hệ 0. Thế hệ già được thu gom tăng dần : sau mỗi "threshold2" lần thu gom thế hệ 1, một phần
+	  ( PYCPP_GC_INCREMENT Object và các Object được theo dõi mà chúng với tới ) được kiểm tra cùng các thế hệ trẻ.
+
+	(!) : bộ thu gom duyệt đồ thị Object, không gọi khi thread khác đang thay đổi các container được theo dõi.
+	Chương trình nhiều thread nên tắt thu gom tự động và gọi "gc_collect" tại các điểm an toàn.
+	(!) : con trỏ thô không được tính là tham chiếu : giữ Object bằng Var / INREF qua các điểm có thể thu gom
+	( tạo mới container ).
+	*/
+
+	// Thêm "object" vào thế hệ 0, có thể kích hoạt thu gom tự động ( trước khi thêm ).
+	// Không làm gì nếu "node" đã được theo dõi.
+	void gc_track(Object* object, __GCNode& node);
+
+	// Xóa Object khỏi danh sách theo dõi, không làm gì nếu "node" chưa được theo dõi.
+	void gc_untrack(__GCNode& node);
+
+	// Vị trí của Object trong danh sách theo dõi, là thành viên của các lớp được theo dõi.
+	struct __GCNode final
+	{
+		u32 slot;
+		u8 generation;
+		bool tracked;
+
+		inline __GCNode() : slot(0u), generation(0u), tracked(false) {}
+
+		// Theo dõi "owner" ngay khi khởi tạo.
+		inline explicit __GCNode(Object* owner) : __GCNode()
+		{
+			gc_track(owner, *this);
+		}
+
+		__GCNode(const __GCNode&) = delete;
+		__GCNode& operator=(const __GCNode&) = delete;
+
+		inline ~__GCNode()
+		{
+			if (tracked)
+				gc_untrack(*this);
+		}
+	};
+
+	// Thu gom các thế hệ từ 0 đến "generation" ( mặc định : toàn bộ ), trả về số Object được giải phóng.
+	// Trả về 0 nếu bộ thu gom đang chạy.
+	u32 gc_collect(u32 generation = PYCPP_GC_GENERATIONS - 1u);
+
+	// Thu gom các thế hệ trẻ cùng một phần của thế hệ già, trả về số Object được giải phóng.
+	u32 gc_collect_increment();
+
+	// Bật / tắt thu gom tự động ( "gc_collect" vẫn hoạt động khi tắt ).
+	void gc_enable();
+	void gc_disable();
+	bool gc_is_enabled();
+
+	// Ngưỡng thu gom tự động của từng thế hệ, xem mô tả ở trên ( "threshold0" bằng 0 : không thu gom tự động ).
+	void gc_set_threshold(u32 threshold0, u32 threshold1, u32 threshold2);
+
+	// Số Object của thế hệ già được kiểm tra trong mỗi lần thu gom tăng dần ( tối thiểu 1 ).
+	void gc_set_increment(u32 increment);
+
+	// Số Object đang được theo dõi trong thế hệ "generation".
+	u32 gc_tracked_count(u32 generation);
+
+#pragma endregion
+
+}
\ No newline at end of file
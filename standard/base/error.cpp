@@ -61,6 +61,36 @@ namespace pycpp
 		throw std::exception("Error : retrieve from an empty container");
 	}
 
+	void __pycpp_error_modify_frozen_object(const char* block_location, const char* class_name)
+	{
+		char content_error[128];
+		sprintf_s(content_error,
+			"Error in %s : cannot modify a frozen %s !", block_location, class_name);
+
+		std::cout << content_error << std::endl;
+		throw std::exception("Error : cannot modify a frozen object");
+	}
+
+	void __pycpp_error_cannot_freeze(const char* class_name)
+	{
+		char content_error[128];
+		sprintf_s(content_error,
+			"Error in freeze : %s is mutable and cannot be frozen !", class_name);
+
+		std::cout << content_error << std::endl;
+		throw std::exception("Error : cannot freeze a mutable object");
+	}
+
+	void __pycpp_error_modify_interned_object(const char* block_location, const char* class_name)
+	{
+		char content_error[128];
+		sprintf_s(content_error,
+			"Error in %s : cannot modify an interned %s !", block_location, class_name);
+
+		std::cout << content_error << std::endl;
+		throw std::exception("Error : cannot modify an interned object");
+	}
+
 #pragma endregion
 
 }
\ No newline at end of file
@@ -11,6 +11,9 @@ namespace pycpp
 	void __pycpp_error_out_of_bound(const char* block_location);
 	void __pycpp_object_is_none(const char* block_location, const char* class_name);
 	void __pycpp_error_retrieve_from_empty_container(const char* block_location, const char* class_name);
+	void __pycpp_error_modify_frozen_object(const char* block_location, const char* class_name);
+	void __pycpp_error_cannot_freeze(const char* class_name);
+	void __pycpp_error_modify_interned_object(const char* block_location, const char* class_name);
 
 	/// <summary>
 	/// Cảnh báo lên "console" nếu Cast không thành công.
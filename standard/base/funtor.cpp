@@ -15,8 +15,7 @@ namespace pycpp
 		INREF(tup);
 		auto result = lambda(tup);
 
-		DEREF(tup);
-		SAFE(tup);
+		DECREF(tup);
 		return result;
 	}
 
@@ -31,8 +30,7 @@ namespace pycpp
 		INREF(param);
 		auto result = lambda(param);
 
-		DEREF(param);
-		SAFE(param);
+		DECREF(param);
 		return result;
 	}
 
@@ -50,8 +48,7 @@ namespace pycpp
 		}
 
 		bool result = lambda(param);
-		DEREF(param);
-		SAFE(param);
+		DECREF(param);
 
 		return (result) ? TRUE : FALSE;
 	}
@@ -67,8 +64,7 @@ namespace pycpp
 		INREF(param);
 		auto result = lambda(param);
 
-		DEREF(param);
-		SAFE(param);
+		DECREF(param);
 		return result;
 	}
 
@@ -86,8 +82,7 @@ namespace pycpp
 		}
 
 		Object* result = lambda(param);
-		DEREF(param);
-		SAFE(param);
+		DECREF(param);
 
 		return result;
 	}
@@ -104,8 +99,7 @@ namespace pycpp
 		INREF(param_1);
 		i32 result = lambda(param_0, param_1);
 
-		DEREF(param_0);
-		SAFE(param_0);
+		DECREF(param_0);
 		SAFE(param_0);
 		SAFE(param_1);
 		return result;
@@ -143,11 +137,9 @@ namespace pycpp
 
 		i32 result = lambda(param_0, param_1);
 
-		DEREF(param_0);
-		SAFE(param_0);
-		DEREF(param_1);
-		SAFE(param_1);
-		return new I32(result);
+		DECREF(param_0);
+		DECREF(param_1);
+		return I32::from(result);
 	}
 
 #pragma endregion
@@ -0,0 +1,199 @@
+#include "intern.hpp"
+#include "str.hpp"
+#include "var.hpp"
+#include "../collections/tuple.hpp"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pycpp
+{
+
+#pragma region Definition : Intern Table State
+
+	struct __InternState
+	{
+		std::mutex lock;
+
+		// hash -> Object chuẩn ( giữ yếu ).
+		std::unordered_multimap<u64, Object*> table;
+	};
+
+	static __InternState& intern_state()
+	{
+		// Không bao giờ hủy : Object đã intern có thể bị hủy sau biến tĩnh khác.
+		static __InternState* state = new __InternState();
+		return *state;
+	}
+
+	static bool is_internable(Object* object)
+	{
+		switch (object->type_index())
+		{
+		case TypeIndex::Str:
+		case TypeIndex::Tuple:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// Phần tử được phép của Tuple intern được.
+	static bool is_immutable_scalar(Object* object)
+	{
+		switch (object->type_index())
+		{
+		case TypeIndex::None:
+		case TypeIndex::Boolean:
+		case TypeIndex::I32:
+		case TypeIndex::I64:
+		case TypeIndex::F32:
+		case TypeIndex::F64:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+#pragma endregion
+
+#pragma region Definition : Intern Table
+
+	Object* __intern_object(Object* object, bool shared)
+	{
+		if (object == nullptr)
+			return object;
+
+		if (object->is_interned() || !is_internable(object))
+		{
+			INREF(object);
+			return object;
+		}
+
+		// Hash-consing : thay phần tử bằng bản chuẩn trước khi tìm Tuple
+		if (object->type_index() == TypeIndex::Tuple)
+		{
+			auto tuple = static_cast<Tuple*>(object);
+			shared = shared || tuple->is_frozen() || tuple->ref_count.load() > 1u;
+
+			for (u32 i = 0u; i < tuple->len; ++i)
+			{
+				auto element = tuple->data[i];
+				if (is_immutable_scalar(element))
+					continue;
+
+				// Tuple vẫn giữ tham chiếu tới "element" nên "intern" không giải phóng nó
+				auto canonical = __intern_object(element, shared);
+				if (canonical == element)
+				{
+					DEREF(element);
+					if (!element->is_interned())
+					{
+						INREF(object);
+						return object;
+					}
+					continue;
+				}
+
+				// Tuple dùng chung hoặc đã freeze : thay phần tử trên bản sao
+				if (shared)
+				{
+					auto fresh = new Tuple(*tuple);
+					SAFE(tuple);
+					tuple = fresh;
+					object = fresh;
+					shared = false;
+				}
+
+				// Tuple nhận tham chiếu mới của "canonical"
+				tuple->data[i] = canonical;
+				DECREF(element);
+			}
+		}
+
+		auto hash_value = object->hash();
+		auto type_index = object->type_index();
+
+		auto& state = intern_state();
+		std::unique_lock<std::mutex> guard(state.lock);
+
+		// Giữ "object" trong lúc so sánh : "equal" không được giải phóng nó,
+		// tham chiếu này được trả về nếu "object" trở thành Object chuẩn
+		INREF(object);
+		Object* result = nullptr;
+
+		// Object trong bảng đã được tăng tham chiếu nhưng không bằng "object" :
+		// giảm tham chiếu sau khi mở khóa ( hàm hủy của Object đã intern cần khóa )
+		std::vector<Object*> mismatched;
+
+		auto range = state.table.equal_range(hash_value);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			auto stored = it->second;
+			if (stored->type_index() != type_index)
+				continue;
+
+			// Số tham chiếu bằng 0 : đang bị hủy ( chờ khóa trong "intern_discard" )
+			if (!stored->ref_count.try_increase())
+				continue;
+
+			if (object->equal(stored))
+			{
+				result = stored;
+				break;
+			}
+			mismatched.push_back(stored);
+		}
+
+		if (result == nullptr)
+		{
+			state.table.emplace(hash_value, object);
+			object->__flags |= Object::OBJECT_INTERNED;
+		}
+		guard.unlock();
+
+		for (auto stored : mismatched)
+			DECREF(stored);
+
+		if (result == nullptr)
+			return object;
+
+		DEREF(object);
+		SAFE(object);
+		return result;
+	}
+
+	Object* intern(Object* object)
+	{
+		return __intern_object(object, false);
+	}
+
+	void intern_discard(Object* object)
+	{
+		auto& state = intern_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+
+		auto range = state.table.equal_range(object->hash());
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == object)
+			{
+				state.table.erase(it);
+				break;
+			}
+		}
+
+		object->__flags &= u8(~Object::OBJECT_INTERNED);
+	}
+
+	u32 intern_count()
+	{
+		auto& state = intern_state();
+		std::lock_guard<std::mutex> guard(state.lock);
+		return u32(state.table.size());
+	}
+
+#pragma endregion
+
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "object.hpp"
+
+namespace pycpp
+{
+
+#pragma region Declaration : Intern Table
+
+	/*
+	Intern Table : bảng các Object bất biến chuẩn ( canonical ), mỗi giá trị chỉ có một Object.
+
+	- Chấp nhận Str và Tuple chỉ chứa None, Boolean, I32, I64, F32, F64, Str và Tuple intern được.
+	  Các phần tử Str / Tuple của Tuple được intern trước ( hash-consing ), Tuple giữ bản chuẩn.
+	- Bảng giữ yếu : không tăng tham chiếu, Object bị xóa khỏi bảng trong hàm hủy của nó.
+	- Object đã intern có cờ "is_interned", Str đã intern không thể "assign" / "append".
+	  "equal" vẫn so sánh nội dung : Object chuẩn đang hủy có thể cùng tồn tại với Object chuẩn mới.
+	- Bảng được bảo vệ bằng khóa, Object có số tham chiếu bằng 0 ( đang hủy ) không được trả về :
+	  tham chiếu được tăng bằng "try_increase" trong khi giữ khóa.
+	- Tuple dùng chung ( nhiều tham chiếu ) hoặc đã freeze không bị thay đổi : phần tử được thay trên bản sao,
+	  bản sao trở thành Object chuẩn.
+	*/
+
+	// Trả về tham chiếu mới ( INREF ) tới Object chuẩn bằng "object", người gọi phải DECREF.
+	// Nếu bảng đã có Object bằng "object" : giải phóng "object" ( SAFE ) và trả về Object trong bảng,
+	// ngược lại "object" trở thành Object chuẩn. Object không intern được trả về nguyên vẹn ( cũng được INREF ).
+	Object* intern(Object* object);
+
+	// Tương tự "intern" với kiểu cụ thể ( Str, Tuple ).
+	template<typename T>
+	inline T* intern(T* object)
+	{
+		return static_cast<T*>(intern(static_cast<Object*>(object)));
+	}
+
+	// "intern" với "shared" : "object" có thể đang được thread khác đọc ( phần tử của Tuple dùng chung ),
+	// không được thay đổi.
+	Object* __intern_object(Object* object, bool shared);
+
+	// Xóa "object" khỏi bảng, được gọi bởi hàm hủy của Object đã intern.
+	void intern_discard(Object* object);
+
+	// Số Object trong bảng.
+	u32 intern_count();
+
+#pragma endregion
+
+}
\ No newline at end of file
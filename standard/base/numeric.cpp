@@ -0,0 +1,235 @@
+#include "numeric.hpp"
+#include "primitive.hpp"
+
+#include <type_traits>
+
+#pragma warning(disable: 4244)
+
+namespace pycpp
+{
+
+#pragma region Numeric Traits
+
+	// Thông tin của kiểu số học : "rank" ( thứ tự bao quát ) và cách đọc giá trị.
+	template <typename T>
+	struct __NumericTraits;
+
+	template <>
+	struct __NumericTraits<Boolean>
+	{
+		static constexpr const i32 rank = 0;
+		static inline i32 load(Object* object)
+		{
+			return object == TRUE ? 1 : 0;
+		}
+	};
+
+	template <>
+	struct __NumericTraits<I32>
+	{
+		static constexpr const i32 rank = 1;
+		static inline i32 load(Object* object)
+		{
+			return static_cast<const I32*>(object)->value;
+		}
+	};
+
+	template <>
+	struct __NumericTraits<I64>
+	{
+		static constexpr const i32 rank = 2;
+		static inline i64 load(Object* object)
+		{
+			return static_cast<const I64*>(object)->value;
+		}
+	};
+
+	template <>
+	struct __NumericTraits<F32>
+	{
+		static constexpr const i32 rank = 3;
+		static inline f32 load(Object* object)
+		{
+			return static_cast<const F32*>(object)->value;
+		}
+	};
+
+	template <>
+	struct __NumericTraits<F64>
+	{
+		static constexpr const i32 rank = 4;
+		static inline f64 load(Object* object)
+		{
+			return static_cast<const F64*>(object)->value;
+		}
+	};
+
+	template <i32 Rank>
+	struct __NumericOfRank;
+
+	template <> struct __NumericOfRank<1> { using type = I32; };
+	template <> struct __NumericOfRank<2> { using type = I64; };
+	template <> struct __NumericOfRank<3> { using type = F32; };
+	template <> struct __NumericOfRank<4> { using type = F64; };
+
+	constexpr inline i32 __max_rank(i32 a, i32 b)
+	{
+		return a > b ? a : b;
+	}
+
+	// Kiểu kết quả của add / sub / mul, đồng thời là kiểu dùng để so sánh.
+	template <typename A, typename B>
+	using __promote_t = typename __NumericOfRank<
+		__max_rank(__max_rank(__NumericTraits<A>::rank, __NumericTraits<B>::rank), 1)
+	>::type;
+
+	// Kiểu kết quả của div : số thực, trừ khi số chia là Boolean.
+	template <typename A, typename B>
+	using __promote_div_t = typename __NumericOfRank<
+		__max_rank(__max_rank(__NumericTraits<A>::rank, __NumericTraits<B>::rank),
+			std::is_same_v<B, Boolean> ? 1 : 3)
+	>::type;
+
+	template <typename T>
+	using __value_t = std::remove_const_t<decltype(T::value)>;
+
+#pragma endregion
+
+#pragma region Kernels
+
+	template <typename A, typename B>
+	Object* __kernel_add(Object* left, Object* right)
+	{
+		using R = __promote_t<A, B>;
+		using r_t = __value_t<R>;
+		return R::from(r_t(__NumericTraits<A>::load(left)) + r_t(__NumericTraits<B>::load(right)));
+	}
+
+	template <typename A, typename B>
+	Object* __kernel_sub(Object* left, Object* right)
+	{
+		using R = __promote_t<A, B>;
+		using r_t = __value_t<R>;
+		return R::from(r_t(__NumericTraits<A>::load(left)) - r_t(__NumericTraits<B>::load(right)));
+	}
+
+	template <typename A, typename B>
+	Object* __kernel_mul(Object* left, Object* right)
+	{
+		using R = __promote_t<A, B>;
+		using r_t = __value_t<R>;
+		return R::from(r_t(__NumericTraits<A>::load(left)) * r_t(__NumericTraits<B>::load(right)));
+	}
+
+	template <typename A, typename B>
+	Object* __kernel_div(Object* left, Object* right)
+	{
+		using R = __promote_div_t<A, B>;
+		using r_t = __value_t<R>;
+		return R::from(r_t(__NumericTraits<A>::load(left)) / r_t(__NumericTraits<B>::load(right)));
+	}
+
+	template <typename A, typename B>
+	bool __kernel_equal(Object* left, Object* right)
+	{
+		using r_t = __value_t<__promote_t<A, B>>;
+		return r_t(__NumericTraits<A>::load(left)) == r_t(__NumericTraits<B>::load(right));
+	}
+
+	template <typename A, typename B>
+	i32 __kernel_compare(Object* left, Object* right)
+	{
+		using r_t = __value_t<__promote_t<A, B>>;
+		r_t a = r_t(__NumericTraits<A>::load(left));
+		r_t b = r_t(__NumericTraits<B>::load(right));
+		return i32(a > b) - i32(a < b);
+	}
+
+#pragma endregion
+
+#pragma region Dispatch Tables
+
+	typedef Object* (*__ArithmeticKernel)(Object*, Object*);
+	typedef bool (*__EqualKernel)(Object*, Object*);
+	typedef i32 (*__CompareKernel)(Object*, Object*);
+
+	// Thứ tự hàng / cột trùng với "numeric_slot".
+#define __NUMERIC_ROW(kernel, A)	\
+	{ kernel<A, Boolean>, kernel<A, I32>, kernel<A, I64>, kernel<A, F32>, kernel<A, F64> }
+
+#define __NUMERIC_TABLE(kernel)	\
+	{	\
+		__NUMERIC_ROW(kernel, Boolean),	\
+		__NUMERIC_ROW(kernel, I32),	\
+		__NUMERIC_ROW(kernel, I64),	\
+		__NUMERIC_ROW(kernel, F32),	\
+		__NUMERIC_ROW(kernel, F64)	\
+	}
+
+	static const __ArithmeticKernel __add_table[NUMERIC_TYPE_COUNT][NUMERIC_TYPE_COUNT] = __NUMERIC_TABLE(__kernel_add);
+	static const __ArithmeticKernel __sub_table[NUMERIC_TYPE_COUNT][NUMERIC_TYPE_COUNT] = __NUMERIC_TABLE(__kernel_sub);
+	static const __ArithmeticKernel __mul_table[NUMERIC_TYPE_COUNT][NUMERIC_TYPE_COUNT] = __NUMERIC_TABLE(__kernel_mul);
+	static const __ArithmeticKernel __div_table[NUMERIC_TYPE_COUNT][NUMERIC_TYPE_COUNT] = __NUMERIC_TABLE(__kernel_div);
+	static const __EqualKernel __equal_table[NUMERIC_TYPE_COUNT][NUMERIC_TYPE_COUNT] = __NUMERIC_TABLE(__kernel_equal);
+	static const __CompareKernel __compare_table[NUMERIC_TYPE_COUNT][NUMERIC_TYPE_COUNT] = __NUMERIC_TABLE(__kernel_compare);
+
+#undef __NUMERIC_TABLE
+#undef __NUMERIC_ROW
+
+	static inline Object* __arithmetic(
+		const __ArithmeticKernel (&table)[NUMERIC_TYPE_COUNT][NUMERIC_TYPE_COUNT],
+		Object* left, Object* right)
+	{
+		i32 row = numeric_slot(left->type_index());
+		i32 column = numeric_slot(right->type_index());
+		if (row < 0 || column < 0)
+			return nullptr;
+
+		return table[row][column](left, right);
+	}
+
+#pragma endregion
+
+#pragma region Definition : Numeric Dispatch
+
+	Object* numeric_add(Object* left, Object* right)
+	{
+		return __arithmetic(__add_table, left, right);
+	}
+
+	Object* numeric_sub(Object* left, Object* right)
+	{
+		return __arithmetic(__sub_table, left, right);
+	}
+
+	Object* numeric_mul(Object* left, Object* right)
+	{
+		return __arithmetic(__mul_table, left, right);
+	}
+
+	Object* numeric_div(Object* left, Object* right)
+	{
+		return __arithmetic(__div_table, left, right);
+	}
+
+	bool numeric_equal(Object* left, Object* right)
+	{
+		i32 row = numeric_slot(left->type_index());
+		i32 column = numeric_slot(right->type_index());
+		if (row < 0 || column < 0)
+			return false;
+
+		return __equal_table[row][column](left, right);
+	}
+
+	i32 numeric_compare(Object* left, Object* right)
+	{
+		return __compare_table
+			[numeric_slot(left->type_index())]
+			[numeric_slot(right->type_index())]
+			(left, right);
+	}
+
+#pragma endregion
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "object.hpp"
+
+namespace pycpp
+{
+
+#pragma region Declaration : Numeric Dispatch
+
+	/*
+	Numeric Dispatch : bảng ( kiểu x kiểu ) cho các phép toán giữa Boolean, I32, I64, F32, F64.
+
+	- Mỗi cặp kiểu có một hàm xử lý ( kernel ) riêng, phép toán chỉ tốn một lần gọi gián tiếp qua bảng
+	  thay vì chuỗi if / else trên "type()".
+	- Kiểu kết quả : kiểu "lớn hơn" của hai toán hạng theo thứ tự Boolean < I32 < I64 < F32 < F64,
+	  Boolean + Boolean cho ra I32.
+	- Phép chia : cho ra số thực ( tối thiểu F32 ), riêng số chia là Boolean thì chia nguyên.
+	- Các hàm không giải phóng "left" và "right".
+	*/
+
+	// Số kiểu số học trong bảng.
+	constexpr const u32 NUMERIC_TYPE_COUNT = 5u;
+
+	// Vị trí của kiểu trong bảng, -1 nếu không phải kiểu số học.
+	constexpr inline i32 numeric_slot(TypeIndex index)
+	{
+		switch (index)
+		{
+		case TypeIndex::Boolean:	return 0;
+		case TypeIndex::I32:		return 1;
+		case TypeIndex::I64:		return 2;
+		case TypeIndex::F32:		return 3;
+		case TypeIndex::F64:		return 4;
+		default:					return -1;
+		}
+	}
+
+	// True nếu "object" là Boolean, I32, I64, F32 hoặc F64.
+	inline bool is_numeric(Object* object)
+	{
+		return numeric_slot(object->type_index()) >= 0;
+	}
+
+	// Trả về Object mới mang giá trị "left + right".
+	// Trả về nullptr nếu một trong hai không phải kiểu số học.
+	Object* numeric_add(Object* left, Object* right);
+
+	// Trả về Object mới mang giá trị "left - right".
+	// Trả về nullptr nếu một trong hai không phải kiểu số học.
+	Object* numeric_sub(Object* left, Object* right);
+
+	// Trả về Object mới mang giá trị "left * right".
+	// Trả về nullptr nếu một trong hai không phải kiểu số học.
+	Object* numeric_mul(Object* left, Object* right);
+
+	// Trả về Object mới mang giá trị "left / right".
+	// Trả về nullptr nếu một trong hai không phải kiểu số học.
+	Object* numeric_div(Object* left, Object* right);
+
+	// So sánh giá trị, trả về false nếu một trong hai không phải kiểu số học.
+	bool numeric_equal(Object* left, Object* right);
+
+	// So sánh ba chiều : -1 nếu "left < right", 1 nếu "left > right", 0 nếu bằng nhau ( hoặc NaN ).
+	// (!) : chỉ gọi khi cả hai là kiểu số học ( is_numeric ).
+	i32 numeric_compare(Object* left, Object* right);
+
+#pragma endregion
+
+}
@@ -3,6 +3,11 @@
 #include "var.hpp"
 #include "primitive.hpp"
 #include "pair.hpp"
+#include "numeric.hpp"
+#include "../collections/map.hpp"
+
+#include <unordered_set>
+#include <vector>
 
 #pragma warning(disable : 4996)
 
@@ -11,13 +16,29 @@ namespace pycpp
 
 #pragma region Object
 
-	Object::Object() : ref_count(0u) {}
+	Object::Object() :
+		ref_count(),
+		__type_index(u16(TypeIndex::Unresolved)),
+		__capabilities(0u),
+		__flags(0u)
+	{}
+
+	void Object::resolve_type_info()
+	{
+		auto index = type_index_of(type());
+		__capabilities = type_capabilities(index);
+		__type_index = u16(index);
+	}
 
 	i64 Object::type()
 	{
 		return -1;
 	}
 
+	void Object::traverse(TraverseVisitor, void*) {}
+
+	void Object::clear_references() {}
+
 	std::string Object::class_name()
 	{
 		return "Unknown";
@@ -134,7 +155,7 @@ namespace pycpp
 
 	Boolean::Boolean()
 	{
-		ref_count = 1u;
+		ref_count.make_immortal();
 	}
 
 	void Boolean::output()
@@ -164,7 +185,7 @@ namespace pycpp
 	{
 		char content[64];
 		std::sprintf(content, "<%s, reference : %d>",
-			IS(this, TRUE) ? "True" : "False", ref_count);
+			IS(this, TRUE) ? "True" : "False", ref_count.load());
 		out = content;
 	}
 
@@ -195,34 +216,11 @@ namespace pycpp
 	bool Boolean::equal(Object* other)
 	{
 		bool result = false;
-		i32 value_of_this = (IS(this, TRUE) ? 1 : 0);
-
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = this == other;
-			break;
-
-		case I32::type_id:
-			result = value_of_this == static_cast<const I32*>(other)->value;
-			break;
 
-		case I64::type_id:
-			result = value_of_this == static_cast<const I64*>(other)->value;
-			break;
-		
-		case F32::type_id:
-			result = value_of_this == static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value_of_this == static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_equal(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = equal(static_cast<Pair*>(other)->key());
-			break;
-		}
 
 		SAFE(other);
 		return result;
@@ -231,35 +229,12 @@ namespace pycpp
 	i32 Boolean::rich_compare(Object* other)
 	{
 		i32 result;
-		i32 value_of_this = (IS(this, TRUE) ? 1 : 0);
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value_of_this - (IS(other, TRUE) ? 1 : 0);
-			break;
-
-		case I32::type_id:
-			result = value_of_this - static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = i32(i64(value_of_this) - static_cast<const I64*>(other)->value);
-			break;
-
-		case F32::type_id:
-			result = i32(f32(value_of_this) - static_cast<const F32*>(other)->value);
-			break;
-
-		case F64::type_id:
-			result = i32(f64(value_of_this) - static_cast<const F64*>(other)->value);
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_compare(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = rich_compare(static_cast<Pair*>(other)->key());
-			break;
-
-		default:
+		else
 		{
 			auto __class_name = class_name();
 			char content_error[128];
@@ -273,38 +248,14 @@ namespace pycpp
 			std::cout << content_error << std::endl;
 			throw std::exception("Error : compare with invalid data type");
 		}
-		}
 
 		SAFE(other);
 		return result;
 	}
 
 	Object* Boolean::add(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-		i32 value_of_this = (IS(this, TRUE) ? 1 : 0);
-
-		if (other_type == Boolean::type_id)
-			result = new I32(
-				value_of_this + (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I32(
-				value_of_this + static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value_of_this + static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value_of_this + static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value_of_this + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_add(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			std::sprintf(content_error,
@@ -321,31 +272,8 @@ namespace pycpp
 	}
 
 	Object* Boolean::sub(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-		i32 value_of_this = (IS(this, TRUE) ? 1 : 0);
-
-		if (other_type == Boolean::type_id)
-			result = new I32(
-				value_of_this - (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I32(
-				value_of_this - static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value_of_this - static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value_of_this - static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value_of_this - static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_sub(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			std::sprintf(content_error,
@@ -362,31 +290,8 @@ namespace pycpp
 	}
 
 	Object* Boolean::mul(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-		i32 value_of_this = (IS(this, TRUE) ? 1 : 0);
-
-		if (other_type == Boolean::type_id)
-			result = new I32(
-				value_of_this * (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I32(
-				value_of_this * static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value_of_this * static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value_of_this * static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value_of_this * static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_mul(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			std::sprintf(content_error,
@@ -403,31 +308,8 @@ namespace pycpp
 	}
 
 	Object* Boolean::div(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-		i32 value_of_this = (IS(this, TRUE) ? 1 : 0);
-
-		if (other_type == Boolean::type_id)
-			result = new I32(
-				value_of_this / (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new F32(
-				f32(value_of_this) / static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F32(
-				f32(value_of_this) / static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value_of_this / static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value_of_this / static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_div(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			std::sprintf(content_error,
@@ -451,7 +333,7 @@ namespace pycpp
 
 	None::None()
 	{
-		ref_count = 1u;
+		ref_count.make_immortal();
 	}
 
 	void None::output()
@@ -474,7 +356,7 @@ namespace pycpp
 	void None::info(std::string& out)
 	{
 		char content[64];
-		std::sprintf(content, "<None, reference : %d>", ref_count);
+		std::sprintf(content, "<None, reference : %d>", ref_count.load());
 		out = content;
 	}
 
@@ -546,4 +428,80 @@ namespace pycpp
 
 #pragma endregion
 
+#pragma region Freeze
+
+	static inline bool is_freezable(TypeIndex index)
+	{
+		switch (index)
+		{
+		case TypeIndex::None:
+		case TypeIndex::Boolean:
+		case TypeIndex::I32:
+		case TypeIndex::I64:
+		case TypeIndex::F32:
+		case TypeIndex::F64:
+		case TypeIndex::Str:
+		case TypeIndex::Pair:
+		case TypeIndex::Tuple:
+		case TypeIndex::Range:
+		case TypeIndex::OrderedMap:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	struct __FreezeContext
+	{
+		std::vector<Object*> pending;
+		std::unordered_set<Object*> visited;
+	};
+
+	static void freeze_visit(Object* child, void* context)
+	{
+		auto freeze_context = static_cast<__FreezeContext*>(context);
+		if (child == nullptr || child->is_frozen())
+			return;
+
+		if (freeze_context->visited.insert(child).second)
+			freeze_context->pending.push_back(child);
+	}
+
+	void freeze(Object* object)
+	{
+		if (object == nullptr || object->is_frozen())
+			return;
+
+		// Lần 1 : duyệt và kiểm tra toàn bộ đồ thị ( không đệ quy ), chưa đánh dấu Object nào
+		__FreezeContext context;
+		context.visited.insert(object);
+		context.pending.push_back(object);
+
+		while (!context.pending.empty())
+		{
+			auto current = context.pending.back();
+			context.pending.pop_back();
+
+			if (!is_freezable(current->type_index()))
+				__pycpp_error_cannot_freeze(current->class_name().c_str());
+
+			current->traverse(freeze_visit, &context);
+		}
+
+		// Lần 2 : đánh dấu
+		for (auto current : context.visited)
+		{
+			// Tính trước hash được lưu lại : Object đã freeze có thể được đọc đồng thời từ nhiều thread
+			if (current->type_index() == TypeIndex::Str)
+				current->hash();
+			else if (current->type_index() == TypeIndex::OrderedMap)
+				static_cast<OrderedMap*>(current)->allocation_prepare_freeze();
+
+			current->__flags |= Object::OBJECT_FROZEN;
+			current->ref_count.make_immortal();
+		}
+	}
+
+#pragma endregion
+
 }
\ No newline at end of file
@@ -1,18 +1,32 @@
 #pragma once
 
+#include "refcount.hpp"
+#include "typeinfo.hpp"
+
 #include <iostream>
 #include <string>
+#include <type_traits>
 
 namespace pycpp
 {
 
+	typedef int8_t i8;
+	typedef int16_t i16;
 	typedef int32_t i32;
 	typedef int64_t i64;
+	typedef uint8_t u8;
+	typedef uint16_t u16;
 	typedef uint32_t u32;
 	typedef uint64_t u64;
 	typedef float f32;
 	typedef double f64;
 
+	class Object;
+	struct __GCNode;
+
+	// Hàm được "traverse" gọi với mỗi Object con, "context" do người gọi truyền vào.
+	typedef void (*TraverseVisitor)(Object* child, void* context);
+
 #pragma region Object
 
 	// Object : lớp nguyên mẫu, cần phải kế thừa Object để có thể sử dụng các tính năng của thư viện.
@@ -21,8 +35,29 @@ namespace pycpp
 		Object();
 
 	public:
-		mutable u32 ref_count;
+		// Số tham chiếu, xem PYCPP_REFCOUNT_MODE.
+		mutable __RefCount ref_count;
+
+	private:
+		// Lưu trong phần đệm của header, được xác định ở lần truy vấn đầu tiên.
+		u16 __type_index;
+		u8 __capabilities;
+		u8 __flags;
+
+		// Các bit trong "__flags".
+		static constexpr const u8 OBJECT_FROZEN = 1u << 0;
+		static constexpr const u8 OBJECT_TRACKED = 1u << 1;
+		static constexpr const u8 OBJECT_INTERNED = 1u << 2;
 
+		void resolve_type_info();
+
+		friend void freeze(Object* object);
+		friend void gc_track(Object* object, __GCNode& node);
+		friend void gc_untrack(__GCNode& node);
+		friend Object* __intern_object(Object* object, bool shared);
+		friend void intern_discard(Object* object);
+
+	public:
 		virtual ~Object() = default;
 
 		/// <summary>
@@ -30,6 +65,63 @@ namespace pycpp
 		/// </summary>
 		virtual i64 type();
 
+		/// <summary>
+		/// Định danh dày đặc của lớp đối tượng, chỉ gọi "type()" ở lần đầu tiên.
+		/// Lớp của người dùng luôn là TypeIndex::Unknown.
+		/// </summary>
+		inline TypeIndex type_index()
+		{
+			if (__type_index == u16(TypeIndex::Unresolved))
+				resolve_type_info();
+			return TypeIndex(__type_index);
+		}
+
+		/// <summary>
+		/// True nếu lớp đối tượng có sẵn và triển khai tất cả "capabilities" ( TypeCapability ).
+		/// </summary>
+		inline bool has_capability(u8 capabilities)
+		{
+			if (__type_index == u16(TypeIndex::Unresolved))
+				resolve_type_info();
+			return (__capabilities & capabilities) == capabilities;
+		}
+
+		/// <summary>
+		/// True nếu Object đã bị "freeze" : bất biến và bất tử, có thể đọc từ nhiều thread.
+		/// </summary>
+		inline bool is_frozen() const
+		{
+			return (__flags & OBJECT_FROZEN) != 0u;
+		}
+
+		/// <summary>
+		/// Gọi "visit" với mỗi Object mà Object này tham chiếu trực tiếp.
+		/// Mặc định : không có Object con.
+		/// </summary>
+		virtual void traverse(TraverseVisitor visit, void* context);
+
+		/// <summary>
+		/// True nếu Object được bộ thu gom chu trình theo dõi ( xem "gc_track" ).
+		/// </summary>
+		inline bool is_tracked() const
+		{
+			return (__flags & OBJECT_TRACKED) != 0u;
+		}
+
+		/// <summary>
+		/// True nếu Object là bản chuẩn trong bảng intern ( xem "intern" ).
+		/// </summary>
+		inline bool is_interned() const
+		{
+			return (__flags & OBJECT_INTERNED) != 0u;
+		}
+
+		/// <summary>
+		/// Bỏ toàn bộ tham chiếu tới các Object con ( được bộ thu gom gọi để phá chu trình ).
+		/// Mặc định : không có Object con.
+		/// </summary>
+		virtual void clear_references();
+
 		/// <summary>
 		/// Tên của lớp đối tượng.
 		/// </summary>
@@ -118,6 +210,20 @@ namespace pycpp
 
 #pragma endregion
 
+#pragma region Freeze
+
+	/// <summary>
+	/// Đánh dấu "object" và toàn bộ Object mà nó tham chiếu ( qua "traverse" ) là bất biến và bất tử.
+	/// Sau đó đồ thị Object có thể được đọc từ nhiều thread mà không ghi vào bộ đếm tham chiếu.
+	/// Chỉ chấp nhận các kiểu bất biến : None, Boolean, I32, I64, F32, F64, Str, Pair, Tuple, Range
+	/// và OrderedMap ( các hàm thay đổi OrderedMap / Pair đã freeze sẽ ném lỗi runtime ).
+	/// (!) : hàm ném lỗi runtime nếu đồ thị chứa kiểu khác, khi đó không Object nào bị freeze.
+	/// (!) : chỉ gọi trước khi chia sẻ "object" cho thread khác.
+	/// </summary>
+	void freeze(Object* object);
+
+#pragma endregion
+
 #pragma region Macro
 
 	i64 constexpr pycpp_type_id(const char* class_name, i64 __len__)
@@ -135,6 +241,10 @@ namespace pycpp
 #define TYPE_ID(Type)	\
 	static constexpr const i64 type_id = UNIQUE_ID(Type)
 
+	// Chỉ dành cho các lớp có sẵn đã đăng ký trong TypeIndex.
+#define BUILTIN_TYPE_ID(Kind)	\
+	static constexpr const i64 type_id = i64(pycpp::TypeIndex::Kind)
+
 #define NONE &None::instance
 #define TRUE &Boolean::True
 #define FALSE &Boolean::False
@@ -145,13 +255,32 @@ namespace pycpp
 		return obj == __constant;
 	}
 
+	template <typename T, typename = void>
+	struct __has_as_object : std::false_type {};
+
+	template <typename T>
+	struct __has_as_object<T, std::void_t<decltype(std::declval<T*>()->as_object())>> : std::true_type {};
+
+	// Lấy Object chứa "obj" ( interface ), không tăng tham chiếu.
+	// Sử dụng "as_object()" của interface nếu có, tránh dynamic_cast.
+	template <typename T>
+	inline Object* AS_OBJECT(const T* obj)
+	{
+		if constexpr (std::is_base_of_v<Object, T>)
+			return const_cast<T*>(obj);
+		else if constexpr (__has_as_object<T>::value)
+			return const_cast<T*>(obj)->as_object();
+		else
+			return dynamic_cast<Object*>(const_cast<T*>(obj));
+	}
+
 	template <typename T, typename std::enable_if_t<
 		!std::is_base_of_v<Object, T>
 		, bool> = true>
 	inline bool IS(const T* obj, const Object* __constant)
 	{
 		// T is not base of Object
-		return dynamic_cast<const Object*>(obj) == __constant;
+		return AS_OBJECT(obj) == __constant;
 	}
 
 #pragma endregion
@@ -167,7 +296,7 @@ namespace pycpp
 		~Boolean() = default;
 
 	public:
-		TYPE_ID(Boolean);
+		BUILTIN_TYPE_ID(Boolean);
 
 		static Boolean True;
 		static Boolean False;
@@ -203,7 +332,7 @@ namespace pycpp
 		~None() = default;
 
 	public:
-		TYPE_ID(None);
+		BUILTIN_TYPE_ID(None);
 
 		static None instance;
 
@@ -18,20 +18,24 @@ namespace pycpp
 	{
 		INREF(__key);
 		INREF(__value);
+
+		if (__key->is_tracked())
+			gc_track(this, gc_node);
 	}
 
 	Pair::Pair(Object* key, Object* value) : __key(key), __value(value)
 	{
 		INREF(__key);
 		INREF(__value);
+
+		if (__key->is_tracked() || __value->is_tracked())
+			gc_track(this, gc_node);
 	}
 
 	Pair::~Pair()
 	{
-		DEREF(__key);
-		DEREF(__value);
-		SAFE(__key);
-		SAFE(__value);
+		DECREF(__key);
+		DECREF(__value);
 	}
 
 	#pragma endregion
@@ -95,9 +99,7 @@ namespace pycpp
 	{
 		INREF(other);
 		bool result = __key->equal(other);
-		DEREF(other);
-
-		SAFE(other);
+		DECREF(other);
 		return result;
 	}
 
@@ -105,9 +107,7 @@ namespace pycpp
 	{
 		INREF(other);
 		i32 result = __key->rich_compare(other);
-		DEREF(other);
-
-		SAFE(other);
+		DECREF(other);
 		return result;
 	}
 
@@ -115,15 +115,41 @@ namespace pycpp
 
 	#pragma region Standard Methods
 
+	void Pair::traverse(TraverseVisitor visit, void* context)
+	{
+		visit(__key, context);
+		visit(__value, context);
+	}
+
+	void Pair::clear_references()
+	{
+		// Chỉ được gọi bởi bộ thu gom với Pair là rác
+		auto key = __key;
+		auto value = __value;
+
+		__key = NONE;
+		__value = NONE;
+		INREF(__key);
+		INREF(__value);
+
+		DECREF(key);
+		DECREF(value);
+	}
+
 	void Pair::set(Object* value)
 	{
+		if (is_frozen())
+			__pycpp_error_modify_frozen_object("Pair::set", "Pair");
+
 		// Cần INREF tham số 'value' trước
 		// tránh trường hợp 'value' chính là 'this->value'
 		INREF(value);
 
-		DEREF(this->__value);
-		SAFE(this->__value);
+		DECREF(this->__value);
 		this->__value = value;
+
+		if (value == this || value->is_tracked())
+			gc_track(this, gc_node);
 	}
 
 	Object* Pair::key()
@@ -3,6 +3,8 @@
 #include <initializer_list>
 
 #include "object.hpp"
+#include "allocator.hpp"
+#include "collector.hpp"
 #include "../collections/map.hpp"
 
 namespace pycpp
@@ -16,11 +18,16 @@ namespace pycpp
 	{
 		friend Map;
 
-		Object* const __key;
+		// Chỉ thay đổi bởi "clear_references".
+		Object* __key;
 		Object* __value;
 
+		// Chỉ được theo dõi khi "__key" hoặc "__value" được theo dõi ( có thể tạo chu trình ).
+		__GCNode gc_node;
+
 	public:
-		TYPE_ID(Pair);
+		BUILTIN_TYPE_ID(Pair);
+		SLAB_ALLOCATOR(Pair);
 
 #pragma region Constructors & Destructor
 
@@ -41,6 +48,8 @@ namespace pycpp
 		u32 bytes() override;
 		u64 hash() override;
 		Object* copy() override;
+		void traverse(TraverseVisitor visit, void* context) override;
+		void clear_references() override;
 
 		bool equal(Object*) override;
 		i32 rich_compare(Object*) override;
@@ -1,12 +1,82 @@
 #include "primitive.hpp"
+#include "numeric.hpp"
 #include "pair.hpp"
 #include "var.hpp"
 
+#include <cmath>
+#include <new>
+
 #pragma warning(disable: 4244)
 
 namespace pycpp
 {
 
+#pragma region Small Number Cache
+
+	// Bộ nhớ đệm số nhỏ của kiểu T ( I32, I64, F32, F64 ).
+	// Các Object được khởi tạo một lần trong vùng nhớ tĩnh, bất tử ( make_immortal ) nên SAFE không bao giờ giải phóng chúng,
+	// tương tự None::instance và Boolean::True/False.
+	// (!) : không sử dụng trong quá trình khởi tạo biến tĩnh của các translation unit khác.
+	template <typename T>
+	class __SmallNumberCache final
+	{
+		using value_t = std::remove_const_t<decltype(T::value)>;
+
+		alignas(T) unsigned char storage[PYCPP_SMALL_INT_COUNT][sizeof(T)];
+
+	public:
+		__SmallNumberCache()
+		{
+			for (i32 i = 0; i < PYCPP_SMALL_INT_COUNT; ++i)
+			{
+				auto object = ::new (storage[i]) T(value_t(PYCPP_SMALL_INT_MIN + i));
+				object->ref_count.make_immortal();
+			}
+		}
+
+		__SmallNumberCache(const __SmallNumberCache&) = delete;
+
+		// Điều kiện : PYCPP_SMALL_INT_MIN <= value <= PYCPP_SMALL_INT_MAX.
+		inline T* get(i64 value)
+		{
+			return reinterpret_cast<T*>(storage[value - PYCPP_SMALL_INT_MIN]);
+		}
+	};
+
+	static __SmallNumberCache<I32> __small_i32;
+	static __SmallNumberCache<I64> __small_i64;
+	static __SmallNumberCache<F32> __small_f32;
+	static __SmallNumberCache<F64> __small_f64;
+
+	inline bool __is_small_int(i64 value)
+	{
+#ifdef PYCPP_DISABLE_SMALL_INT_CACHE
+		return false;
+#else
+		return value >= PYCPP_SMALL_INT_MIN && value <= PYCPP_SMALL_INT_MAX;
+#endif
+	}
+
+	// Kiểm tra số thực "value" có phải số nguyên nằm trong bộ nhớ đệm không.
+	// -0.0 và NaN không được lưu đệm.
+	template <typename T>
+	inline bool __is_small_float(T value)
+	{
+#ifdef PYCPP_DISABLE_SMALL_INT_CACHE
+		return false;
+#else
+		// Phép so sánh trả về false với NaN
+		if (!(value >= T(PYCPP_SMALL_INT_MIN) && value <= T(PYCPP_SMALL_INT_MAX)))
+			return false;
+
+		if (value == T(0))
+			return std::signbit(value) == false;
+		return T(i64(value)) == value;
+#endif
+	}
+
+#pragma endregion
+
 #pragma region I32
 
 #pragma region Constructor & Destructor
@@ -19,6 +89,18 @@ namespace pycpp
 
 	I32::I32(Object* source) : value(init_from_object(source)) {}
 
+	I32* I32::from(i32 value)
+	{
+		if (__is_small_int(value))
+			return __small_i32.get(i64(value));
+		return new I32(value);
+	}
+
+	I32* I32::from_object(Object* source)
+	{
+		return I32::from(init_from_object(source));
+	}
+
 	i32 I32::init_from_object(Object* source)
 	{
 		i32 result;
@@ -82,7 +164,7 @@ namespace pycpp
 
 	Object* I32::copy()
 	{
-		return new I32(value);
+		return I32::from(value);
 	}
 
 	u32 I32::bytes()
@@ -95,32 +177,10 @@ namespace pycpp
 	{
 		bool result = false;
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value == (IS(other, TRUE) ? 1 : 0);
-			break;
-
-		case I32::type_id:
-			result = value == static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = value == static_cast<const I64*>(other)->value;
-			break;
-
-		case F32::type_id:
-			result = value == static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value == static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_equal(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = equal(static_cast<Pair*>(other)->key());
-			break;
-		}
 
 		SAFE(other);
 		return result;
@@ -130,33 +190,11 @@ namespace pycpp
 	{
 		i32 result;
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value < (IS(other, TRUE) ? 1 : 0);
-			break;
-
-		case I32::type_id:
-			result = value < static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = value < static_cast<const I64*>(other)->value;
-			break;
-
-		case F32::type_id:
-			result = value < static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value < static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_compare(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = rich_compare(static_cast<Pair*>(other)->key());
-			break;
-
-		default:
+		else
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -168,7 +206,6 @@ namespace pycpp
 			std::cout << content_error << std::endl;
 			throw std::exception("Error : compare with invalid data type");
 		}
-		}
 
 		SAFE(other);
 		return result;
@@ -176,30 +213,8 @@ namespace pycpp
 
 
 	Object* I32::add(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new I32(
-				value + (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I32(
-				value + static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value + static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value + static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_add(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -216,30 +231,8 @@ namespace pycpp
 	}
 
 	Object* I32::sub(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new I32(
-				value - (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I32(
-				value - static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value - static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value - static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_sub(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -256,30 +249,8 @@ namespace pycpp
 	}
 
 	Object* I32::mul(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new I32(
-				value * (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I32(
-				value * static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value * static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value * static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value * static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_mul(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -296,30 +267,8 @@ namespace pycpp
 	}
 
 	Object* I32::div(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new I32(
-				value / (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new F32(
-				f32(value) / static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F32(
-				f32(value) / static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				f32(value) / static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value / static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_div(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -351,6 +300,18 @@ namespace pycpp
 
 	I64::I64(Object* source) : value(init_from_object(source)) {}
 
+	I64* I64::from(i64 value)
+	{
+		if (__is_small_int(value))
+			return __small_i64.get(i64(value));
+		return new I64(value);
+	}
+
+	I64* I64::from_object(Object* source)
+	{
+		return I64::from(init_from_object(source));
+	}
+
 	i64 I64::init_from_object(Object* source)
 	{
 		i64 result;
@@ -412,7 +373,7 @@ namespace pycpp
 	}
 
 	Object* I64::copy() {
-		return new I64(value);
+		return I64::from(value);
 	}
 
 	u32 I64::bytes()
@@ -425,32 +386,10 @@ namespace pycpp
 	{
 		bool result = false;
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value == (IS(other, TRUE) ? 1 : 0);
-			break;
-
-		case I32::type_id:
-			result = value == static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = value == static_cast<const I64*>(other)->value;
-			break;
-
-		case F32::type_id:
-			result = value == static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value == static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_equal(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = equal(static_cast<Pair*>(other)->key());
-			break;
-		}
 
 		SAFE(other);
 		return result;
@@ -460,33 +399,11 @@ namespace pycpp
 	{
 		i32 result;
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value < (IS(other, TRUE) ? 1 : 0);
-			break;
-
-		case I32::type_id:
-			result = value < static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = value < static_cast<const I64*>(other)->value;
-			break;
-
-		case F32::type_id:
-			result = value < static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value < static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_compare(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = rich_compare(static_cast<Pair*>(other)->key());
-			break;
-
-		default:
+		else
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -498,7 +415,6 @@ namespace pycpp
 			std::cout << content_error << std::endl;
 			throw std::exception("Error : compare with invalid data type");
 		}
-		}
 
 		SAFE(other);
 		return result;
@@ -506,30 +422,8 @@ namespace pycpp
 
 
 	Object* I64::add(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new I64(
-				value + (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I64(
-				value + static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value + static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value + static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_add(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -546,30 +440,8 @@ namespace pycpp
 	}
 
 	Object* I64::sub(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new I64(
-				value - (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I64(
-				value - static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value - static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value - static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_sub(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -586,30 +458,8 @@ namespace pycpp
 	}
 
 	Object* I64::mul(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new I64(
-				value * (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new I64(
-				value * static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new I64(
-				value * static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value * static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value * static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_mul(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -626,30 +476,8 @@ namespace pycpp
 	}
 
 	Object* I64::div(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new I64(
-				value / (IS(other, TRUE) ? 1 : 0)
-			);
-		else if (other_type == I32::type_id)
-			result = new F32(
-				f32(value) / static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F32(
-				f32(value) / static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value / static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value / static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_div(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -681,6 +509,18 @@ namespace pycpp
 
 	F32::F32(Object* source) : value(init_from_object(source)) {}
 
+	F32* F32::from(f32 value)
+	{
+		if (__is_small_float(value))
+			return __small_f32.get(i64(value));
+		return new F32(value);
+	}
+
+	F32* F32::from_object(Object* source)
+	{
+		return F32::from(init_from_object(source));
+	}
+
 	f32 F32::init_from_object(Object* source)
 	{
 		f32 result;
@@ -742,7 +582,7 @@ namespace pycpp
 	}
 
 	Object* F32::copy() {
-		return new F32(value);
+		return F32::from(value);
 	}
 
 	u32 F32::bytes()
@@ -755,32 +595,10 @@ namespace pycpp
 	{
 		bool result = false;
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value == (IS(other, TRUE) ? 1.f : 0.f);
-			break;
-
-		case I32::type_id:
-			result = value == static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = value == static_cast<const I64*>(other)->value;
-			break;
-
-		case F32::type_id:
-			result = value == static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value == static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_equal(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = equal(static_cast<Pair*>(other)->key());
-			break;
-		}
 
 		SAFE(other);
 		return result;
@@ -790,33 +608,11 @@ namespace pycpp
 	{
 		i32 result;
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value < (IS(other, TRUE) ? 1.f : 0.f);
-			break;
-
-		case I32::type_id:
-			result = value < static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = value < static_cast<const I64*>(other)->value;
-			break;
-
-		case F32::type_id:
-			result = value < static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value < static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_compare(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = rich_compare(static_cast<Pair*>(other)->key());
-			break;
-
-		default:
+		else
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -828,7 +624,6 @@ namespace pycpp
 			std::cout << content_error << std::endl;
 			throw std::exception("Error : compare with invalid data type");
 		}
-		}
 
 		SAFE(other);
 		return result;
@@ -836,30 +631,8 @@ namespace pycpp
 
 
 	Object* F32::add(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new F32(
-				value + (IS(other, TRUE) ? 1.f : 0.f)
-			);
-		else if (other_type == I32::type_id)
-			result = new F32(
-				value + static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F32(
-				value + static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value + static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_add(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -876,30 +649,8 @@ namespace pycpp
 	}
 
 	Object* F32::sub(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new F32(
-				value - (IS(other, TRUE) ? 1.f : 0.f)
-			);
-		else if (other_type == I32::type_id)
-			result = new F32(
-				value - static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F32(
-				value - static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value - static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_sub(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -916,30 +667,8 @@ namespace pycpp
 	}
 
 	Object* F32::mul(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new F32(
-				value * (IS(other, TRUE) ? 1.f : 0.f)
-			);
-		else if (other_type == I32::type_id)
-			result = new F32(
-				value * static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F32(
-				value * static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value * static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value * static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_mul(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -956,30 +685,8 @@ namespace pycpp
 	}
 
 	Object* F32::div(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new F32(
-				value / (IS(other, TRUE) ? 1.f : 0.f)
-			);
-		else if (other_type == I32::type_id)
-			result = new F32(
-				value / static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F32(
-				value / static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F32(
-				value / static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value / static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_div(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -1011,6 +718,18 @@ namespace pycpp
 
 	F64::F64(Object* source) : value(init_from_object(source)) {}
 
+	F64* F64::from(f64 value)
+	{
+		if (__is_small_float(value))
+			return __small_f64.get(i64(value));
+		return new F64(value);
+	}
+
+	F64* F64::from_object(Object* source)
+	{
+		return F64::from(init_from_object(source));
+	}
+
 	f64 F64::init_from_object(Object* source)
 	{
 		f64 result;
@@ -1072,7 +791,7 @@ namespace pycpp
 	}
 
 	Object* F64::copy() {
-		return new F64(value);
+		return F64::from(value);
 	}
 
 	u32 F64::bytes()
@@ -1085,32 +804,10 @@ namespace pycpp
 	{
 		bool result = false;
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value == (IS(other, TRUE) ? 1. : 0.);
-			break;
-
-		case I32::type_id:
-			result = value == static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = value == static_cast<const I64*>(other)->value;
-			break;
-
-		case F32::type_id:
-			result = value == static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value == static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_equal(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = equal(static_cast<Pair*>(other)->key());
-			break;
-		}
 
 		SAFE(other);
 		return result;
@@ -1120,33 +817,11 @@ namespace pycpp
 	{
 		i32 result;
 
-		switch (other->type())
-		{
-		case Boolean::type_id:
-			result = value < (IS(other, TRUE) ? 1. : 0.);
-			break;
-
-		case I32::type_id:
-			result = value < static_cast<const I32*>(other)->value;
-			break;
-
-		case I64::type_id:
-			result = value < static_cast<const I64*>(other)->value;
-			break;
-
-		case F32::type_id:
-			result = value < static_cast<const F32*>(other)->value;
-			break;
-
-		case F64::type_id:
-			result = value < static_cast<const F64*>(other)->value;
-			break;
-
-		case Pair::type_id:
+		if (is_numeric(other))
+			result = numeric_compare(this, other);
+		else if (other->type_index() == TypeIndex::Pair)
 			result = rich_compare(static_cast<Pair*>(other)->key());
-			break;
-
-		default:
+		else
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -1158,7 +833,6 @@ namespace pycpp
 			std::cout << content_error << std::endl;
 			throw std::exception("Error : compare with invalid data type");
 		}
-		}
 
 		SAFE(other);
 		return result;
@@ -1166,30 +840,8 @@ namespace pycpp
 
 
 	Object* F64::add(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new F64(
-				value + (IS(other, TRUE) ? 1. : 0.)
-			);
-		else if (other_type == I32::type_id)
-			result = new F64(
-				value + static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F64(
-				value + static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F64(
-				value + static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_add(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -1206,30 +858,8 @@ namespace pycpp
 	}
 
 	Object* F64::sub(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new F64(
-				value - (IS(other, TRUE) ? 1. : 0.)
-			);
-		else if (other_type == I32::type_id)
-			result = new F64(
-				value - static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F64(
-				value - static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F64(
-				value - static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value + static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_sub(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -1246,30 +876,8 @@ namespace pycpp
 	}
 
 	Object* F64::mul(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new F64(
-				value * (IS(other, TRUE) ? 1. : 0.)
-			);
-		else if (other_type == I32::type_id)
-			result = new F64(
-				value * static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F64(
-				value * static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F64(
-				value * static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value * static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_mul(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
@@ -1286,30 +894,8 @@ namespace pycpp
 	}
 
 	Object* F64::div(Object* other) {
-		Object* result = nullptr;
-		i64 other_type = other->type();
-
-		if(other_type == Boolean::type_id)
-			result = new F64(
-				value / (IS(other, TRUE) ? 1. : 0.)
-			);
-		else if (other_type == I32::type_id)
-			result = new F64(
-				value / static_cast<const I32*>(other)->value
-			);
-		else if (other_type == I64::type_id)
-			result = new F64(
-				value / static_cast<const I64*>(other)->value
-			);
-		else if (other_type == F32::type_id)
-			result = new F64(
-				value / static_cast<const F32*>(other)->value
-			);
-		else if (other_type == F64::type_id)
-			result = new F64(
-				value / static_cast<const F64*>(other)->value
-			);
-		else
+		Object* result = numeric_div(this, other);
+		if (result == nullptr)
 		{
 			char content_error[128];
 			sprintf_s(content_error,
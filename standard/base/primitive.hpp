@@ -1,15 +1,39 @@
 #pragma once
 
 #include "object.hpp"
+#include "allocator.hpp"
 
 namespace pycpp {
 
+#pragma region Macro
+
+	// Bộ nhớ đệm số nhỏ : các Object I32, I64, F32, F64 mang giá trị nguyên
+	// trong khoảng [PYCPP_SMALL_INT_MIN, PYCPP_SMALL_INT_MAX] được cấp phát sẵn và không bao giờ bị giải phóng.
+	// (!) : định nghĩa lại hai macro khi biên dịch để thay đổi khoảng giá trị.
+	// (!) : định nghĩa macro "PYCPP_DISABLE_SMALL_INT_CACHE" để tắt bộ nhớ đệm.
+#ifndef PYCPP_SMALL_INT_MIN
+#define PYCPP_SMALL_INT_MIN -5
+#endif
+
+#ifndef PYCPP_SMALL_INT_MAX
+#define PYCPP_SMALL_INT_MAX 1024
+#endif
+
+#define PYCPP_SMALL_INT_COUNT (PYCPP_SMALL_INT_MAX - PYCPP_SMALL_INT_MIN + 1)
+
+	static_assert(PYCPP_SMALL_INT_COUNT > 0,
+		"PYCPP_SMALL_INT_MAX must not be less than PYCPP_SMALL_INT_MIN");
+
+#pragma endregion
+
 #pragma region I32
 
 	class I32 final : public Object
 	{
 	public:
-		TYPE_ID(I32);
+		BUILTIN_TYPE_ID(I32);
+		SLAB_ALLOCATOR(I32);
+
 		const i32 value;
 
 		//==========     Initialize     ==========//
@@ -20,7 +44,18 @@ namespace pycpp {
 		I32(Object* source);
 		~I32() = default;
 
-		i32 init_from_object(Object* source);
+		static i32 init_from_object(Object* source);
+
+		/// <summary>
+		/// Trả về I32 mang giá trị "value".
+		/// Nếu "value" nằm trong bộ nhớ đệm số nhỏ, trả về Object có sẵn thay vì cấp phát mới.
+		/// </summary>
+		static I32* from(i32 value);
+
+		/// <summary>
+		/// Tương tự I32(Object* source), nhưng sử dụng bộ nhớ đệm số nhỏ.
+		/// </summary>
+		static I32* from_object(Object* source);
 
 		//==========     Methods Object     ==========//
 
@@ -89,7 +124,9 @@ namespace pycpp {
 
 	class I64 final : public Object {
 	public:
-		TYPE_ID(I64);
+		BUILTIN_TYPE_ID(I64);
+		SLAB_ALLOCATOR(I64);
+
 		const i64 value;
 
 		//==========     Initialize     ==========//
@@ -100,7 +137,18 @@ namespace pycpp {
 		I64(const I64& source);
 		~I64() = default;
 
-		i64 init_from_object(Object* source);
+		static i64 init_from_object(Object* source);
+
+		/// <summary>
+		/// Trả về I64 mang giá trị "value".
+		/// Nếu "value" nằm trong bộ nhớ đệm số nhỏ, trả về Object có sẵn thay vì cấp phát mới.
+		/// </summary>
+		static I64* from(i64 value);
+
+		/// <summary>
+		/// Tương tự I64(Object* source), nhưng sử dụng bộ nhớ đệm số nhỏ.
+		/// </summary>
+		static I64* from_object(Object* source);
 
 		//==========     Methods Object     ==========//
 
@@ -166,7 +214,9 @@ namespace pycpp {
 
 	class F32 final : public Object {
 	public:
-		TYPE_ID(F32);
+		BUILTIN_TYPE_ID(F32);
+		SLAB_ALLOCATOR(F32);
+
 		const f32 value;
 
 		//==========     Initialize     ==========//
@@ -177,7 +227,18 @@ namespace pycpp {
 		F32(const F32& source);
 		~F32() = default;
 
-		f32 init_from_object(Object* source);
+		static f32 init_from_object(Object* source);
+
+		/// <summary>
+		/// Trả về F32 mang giá trị "value".
+		/// Nếu "value" nằm trong bộ nhớ đệm số nhỏ, trả về Object có sẵn thay vì cấp phát mới.
+		/// </summary>
+		static F32* from(f32 value);
+
+		/// <summary>
+		/// Tương tự F32(Object* source), nhưng sử dụng bộ nhớ đệm số nhỏ.
+		/// </summary>
+		static F32* from_object(Object* source);
 
 		//==========     Methods Object     ==========//
 
@@ -240,7 +301,9 @@ namespace pycpp {
 
 	class F64 final : public Object {
 	public:
-		TYPE_ID(F64);
+		BUILTIN_TYPE_ID(F64);
+		SLAB_ALLOCATOR(F64);
+
 		const f64 value;
 
 		//==========     Initialize     ==========//
@@ -251,7 +314,18 @@ namespace pycpp {
 		F64(const F64& source);
 		~F64() = default;
 
-		f64 init_from_object(Object* source);
+		static f64 init_from_object(Object* source);
+
+		/// <summary>
+		/// Trả về F64 mang giá trị "value".
+		/// Nếu "value" nằm trong bộ nhớ đệm số nhỏ, trả về Object có sẵn thay vì cấp phát mới.
+		/// </summary>
+		static F64* from(f64 value);
+
+		/// <summary>
+		/// Tương tự F64(Object* source), nhưng sử dụng bộ nhớ đệm số nhỏ.
+		/// </summary>
+		static F64* from_object(Object* source);
 
 		//==========     Methods Object     ==========//
 
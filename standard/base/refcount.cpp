@@ -0,0 +1,256 @@
+#include "refcount.hpp"
+#include "object.hpp"
+#include "trashcan.hpp"
+
+#include <mutex>
+#include <vector>
+
+namespace pycpp
+{
+
+#if PYCPP_REFCOUNT_MODE == PYCPP_REFCOUNT_BIASED
+
+#pragma region Definition : Biased Queue
+
+	// Hàng đợi các Object cần gộp của một thread chủ.
+	struct __BiasedQueue
+	{
+		std::mutex lock;
+		std::vector<Object*> objects;
+
+		// Thread chủ đã kết thúc, các thread khác tự gộp thay vì đưa vào hàng đợi.
+		bool closed = false;
+	};
+
+	// Danh sách hàng đợi, vị trí "tag - 1" thuộc về thread có định danh "tag".
+	struct __BiasedRegistry
+	{
+		std::mutex lock;
+		std::vector<__BiasedQueue*> queues;
+	};
+
+	static __BiasedRegistry& biased_registry()
+	{
+		// Khởi tạo khi sử dụng lần đầu : thread_local của các thread khác có thể hủy sau biến tĩnh.
+		static __BiasedRegistry* registry = new __BiasedRegistry();
+		return *registry;
+	}
+
+	static __BiasedQueue* biased_queue(uint32_t tag)
+	{
+		auto& registry = biased_registry();
+		std::lock_guard<std::mutex> guard(registry.lock);
+		return registry.queues[tag - 1u];
+	}
+
+	// Gộp toàn bộ Object trong "queue" rồi giải phóng các Object không còn tham chiếu.
+	// Gộp xong mới giải phóng : hàm hủy có thể giảm tham chiếu của Object khác trong hàng đợi.
+	static void biased_drain(__BiasedQueue* queue, bool close)
+	{
+		std::vector<Object*> objects;
+		{
+			std::lock_guard<std::mutex> guard(queue->lock);
+			queue->closed = queue->closed || close;
+			objects.swap(queue->objects);
+		}
+
+		std::vector<Object*> releasing;
+		for (auto object : objects)
+			if (__biased_merge(object->ref_count))
+				releasing.push_back(object);
+
+		for (auto object : releasing)
+			destroy(object);
+	}
+
+	// Gộp hàng đợi khi thread kết thúc.
+	struct __BiasedThreadState
+	{
+		__BiasedQueue* queue = nullptr;
+
+		~__BiasedThreadState()
+		{
+			if (queue != nullptr)
+				biased_drain(queue, true);
+		}
+	};
+
+	thread_local uint32_t __biased_thread_tag = 0u;
+	static thread_local __BiasedThreadState biased_thread_state;
+
+	uint32_t __biased_register_thread()
+	{
+		auto queue = new __BiasedQueue();
+		uint32_t tag;
+		{
+			auto& registry = biased_registry();
+			std::lock_guard<std::mutex> guard(registry.lock);
+			registry.queues.push_back(queue);
+			tag = uint32_t(registry.queues.size());
+		}
+
+		__biased_thread_tag = tag;
+		biased_thread_state.queue = queue;
+		return tag;
+	}
+
+#pragma endregion
+
+#pragma region Definition : Biased Reference Count
+
+	bool __biased_merge(__RefCount& counter)
+	{
+		auto biased = int32_t(counter.biased.load(std::memory_order_relaxed));
+		counter.biased.store(0u, std::memory_order_relaxed);
+
+		auto state = counter.shared.load(std::memory_order_acquire);
+		int32_t next;
+		do
+		{
+			next = ((state + biased * __RefCount::ONE) | __RefCount::MERGED) & ~__RefCount::QUEUED;
+		} while (!counter.shared.compare_exchange_weak(state, next, std::memory_order_acq_rel));
+
+		// Bỏ quyền chủ sau khi MERGED được đặt, xem "__biased_release_shared"
+		counter.owner.store(0u, std::memory_order_release);
+		return (next >> 2) == 0;
+	}
+
+	bool __biased_try_increase(__RefCount& counter)
+	{
+		auto owner_tag = counter.owner.load(std::memory_order_acquire);
+		if (owner_tag == __RefCount::IMMORTAL_OWNER)
+			return true;
+
+		// Thread chủ : Object chưa gộp chỉ được giải phóng bởi chính thread này
+		if (owner_tag == biased_thread_tag())
+		{
+			auto biased = counter.biased.load(std::memory_order_relaxed);
+			auto state = counter.shared.load(std::memory_order_acquire);
+			if (int32_t(biased) + (state >> 2) <= 0)
+				return false;
+
+			counter.biased.store(biased + 1u, std::memory_order_relaxed);
+			return true;
+		}
+
+		// Thread khác : cộng vào "shared" bằng CAS, "__biased_merge" cũng ghi "shared" bằng CAS
+		// nên Object chỉ bị giải phóng khi tổng tham chiếu đã tính cả lần tăng này
+		auto state = counter.shared.load(std::memory_order_acquire);
+		for (;;)
+		{
+			int32_t total = state >> 2;
+			if (!(state & __RefCount::MERGED))
+				total += int32_t(counter.biased.load(std::memory_order_relaxed));
+			if (total <= 0)
+				return false;
+
+			if (counter.shared.compare_exchange_weak(state, state + __RefCount::ONE, std::memory_order_acq_rel))
+				return true;
+		}
+	}
+
+	bool __biased_release_owner(__RefCount& counter, const Object* object)
+	{
+		auto state = counter.shared.load(std::memory_order_acquire);
+		for (;;)
+		{
+			// Object nằm trong hàng đợi : lấy ra rồi gộp
+			if (state & __RefCount::QUEUED)
+			{
+				auto queue = biased_thread_state.queue;
+				{
+					std::lock_guard<std::mutex> guard(queue->lock);
+					auto& objects = queue->objects;
+					for (auto& queued : objects)
+						if (queued == object)
+						{
+							queued = objects.back();
+							objects.pop_back();
+							break;
+						}
+				}
+				return __biased_merge(counter);
+			}
+
+			if (counter.shared.compare_exchange_weak(state, state | __RefCount::MERGED, std::memory_order_acq_rel))
+			{
+				counter.owner.store(0u, std::memory_order_release);
+				return (state >> 2) == 0;
+			}
+		}
+	}
+
+	// Giảm "shared" khi không cần đưa vào hàng đợi, trả về "false" nếu cần.
+	bool __biased_try_release(__RefCount& counter, int32_t& state, bool& released)
+	{
+		auto next = state - __RefCount::ONE;
+		if (!(state & (__RefCount::MERGED | __RefCount::QUEUED)) && (next >> 2) < 0)
+			return false;
+
+		while (!counter.shared.compare_exchange_weak(state, next, std::memory_order_acq_rel))
+		{
+			next = state - __RefCount::ONE;
+			if (!(state & (__RefCount::MERGED | __RefCount::QUEUED)) && (next >> 2) < 0)
+				return false;
+		}
+
+		released = (next & __RefCount::MERGED) && (next >> 2) == 0;
+		return true;
+	}
+
+	bool __biased_release_shared(__RefCount& counter, const Object* object)
+	{
+		bool released = false;
+		auto state = counter.shared.load(std::memory_order_acquire);
+		if (__biased_try_release(counter, state, released))
+			return released;
+
+		// "count" sắp âm khi chưa gộp : đưa Object vào hàng đợi của thread chủ.
+		// Đọc "owner" trước "shared" : "owner" chỉ về 0 sau khi MERGED được đặt.
+		auto tag = counter.owner.load(std::memory_order_acquire);
+		if (tag == 0u)
+			return __biased_release_shared(counter, object);
+
+		auto queue = biased_queue(tag);
+		std::lock_guard<std::mutex> guard(queue->lock);
+
+		state = counter.shared.load(std::memory_order_acquire);
+		for (;;)
+		{
+			if (__biased_try_release(counter, state, released))
+				return released;
+
+			auto next = state - __RefCount::ONE;
+
+			// Thread chủ đã kết thúc : tự gộp
+			if (queue->closed)
+			{
+				if (counter.shared.compare_exchange_weak(state, next, std::memory_order_acq_rel))
+					return __biased_merge(counter);
+				continue;
+			}
+
+			if (counter.shared.compare_exchange_weak(state, next | __RefCount::QUEUED, std::memory_order_acq_rel))
+			{
+				queue->objects.push_back(const_cast<Object*>(object));
+				return false;
+			}
+		}
+	}
+
+	void merge_biased_references()
+	{
+		auto queue = biased_thread_state.queue;
+		if (queue != nullptr)
+			biased_drain(queue, false);
+	}
+
+#pragma endregion
+
+#else
+
+	void merge_biased_references() {}
+
+#endif
+
+}
\ No newline at end of file
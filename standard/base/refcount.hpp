@@ -0,0 +1,301 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace pycpp
+{
+	class Object;
+
+#pragma region Macro
+
+	// Chế độ đếm tham chiếu, chọn khi biên dịch bằng "PYCPP_REFCOUNT_MODE".
+	// - PYCPP_REFCOUNT_PLAIN : số nguyên thường, chỉ dùng trong một thread ( mặc định ).
+	// - PYCPP_REFCOUNT_ATOMIC : std::atomic, mọi thao tác đều là lệnh atomic.
+	// - PYCPP_REFCOUNT_BIASED : thread tạo Object ( thread chủ ) đếm không atomic,
+	//   các thread khác dùng bộ đếm chung atomic.
+#define PYCPP_REFCOUNT_PLAIN 0
+#define PYCPP_REFCOUNT_ATOMIC 1
+#define PYCPP_REFCOUNT_BIASED 2
+
+#ifndef PYCPP_REFCOUNT_MODE
+#define PYCPP_REFCOUNT_MODE PYCPP_REFCOUNT_PLAIN
+#endif
+
+#pragma endregion
+
+#pragma region Declaration : Reference Count
+
+	/*
+	__RefCount : bộ đếm tham chiếu trong header của Object.
+
+	- increase() : tăng tham chiếu.
+	- try_increase() : tăng tham chiếu nếu Object còn được tham chiếu ( hoặc bất tử ), trả về "false" nếu
+	  số tham chiếu bằng 0 ( Object chưa từng được tham chiếu hoặc đang bị hủy ) : dùng khi Object có thể đang
+	  bị thread khác giải phóng ( ví dụ bảng giữ yếu của "intern" ).
+	- decrease(object) : giảm tham chiếu, trả về "true" nếu người gọi vừa giải phóng tham chiếu cuối cùng
+	  và phải xóa Object ( chỉ một thread nhận "true" ).
+	- is_zero() : Object chưa từng được tham chiếu hoặc không còn tham chiếu ( dùng bởi SAFE ).
+	- make_immortal() : Object bất tử, không bao giờ bị giải phóng ( None, Boolean, Object đã freeze ).
+	  Ở chế độ ATOMIC / BIASED, tăng / giảm tham chiếu của Object bất tử không ghi vào bộ nhớ.
+	- Sao chép Object không sao chép tham chiếu : bản sao bắt đầu từ 0.
+	*/
+
+#if PYCPP_REFCOUNT_MODE == PYCPP_REFCOUNT_PLAIN
+
+	class __RefCount final
+	{
+		uint32_t count;
+
+		// Bộ đếm của Object bất tử bắt đầu từ IMMORTAL, tăng / giảm cân bằng nên không bao giờ về 0.
+		// Chỉ một thread : không cần kiểm tra trước khi ghi.
+		static constexpr const uint32_t IMMORTAL = 1u << 31;
+
+	public:
+		inline __RefCount() : count(0u) {}
+		inline __RefCount(const __RefCount&) : count(0u) {}
+		inline __RefCount& operator=(const __RefCount&) { return *this; }
+
+		inline void increase()
+		{
+			++count;
+		}
+
+		inline bool try_increase()
+		{
+			if (count == 0u)
+				return false;
+			++count;
+			return true;
+		}
+
+		inline bool decrease(const Object*)
+		{
+			return --count == 0u;
+		}
+
+		inline bool is_zero() const
+		{
+			return count == 0u;
+		}
+
+		inline uint32_t load() const
+		{
+			return count;
+		}
+
+		inline bool is_immortal() const
+		{
+			return count >= (IMMORTAL >> 1);
+		}
+
+		// (!) : chỉ gọi trước khi Object được chia sẻ cho thread khác.
+		inline void make_immortal()
+		{
+			count = IMMORTAL;
+		}
+	};
+
+#elif PYCPP_REFCOUNT_MODE == PYCPP_REFCOUNT_ATOMIC
+
+	class __RefCount final
+	{
+		std::atomic<uint32_t> count;
+
+		// Object bất tử có bộ đếm >= IMMORTAL, chỉ đọc trước khi ghi để tránh tranh chấp cache line.
+		static constexpr const uint32_t IMMORTAL = 1u << 31;
+
+	public:
+		inline __RefCount() : count(0u) {}
+		inline __RefCount(const __RefCount&) : count(0u) {}
+		inline __RefCount& operator=(const __RefCount&) { return *this; }
+
+		inline void increase()
+		{
+			if (count.load(std::memory_order_relaxed) >= IMMORTAL)
+				return;
+			count.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		inline bool try_increase()
+		{
+			auto current = count.load(std::memory_order_relaxed);
+			do
+			{
+				if (current >= IMMORTAL)
+					return true;
+				if (current == 0u)
+					return false;
+			} while (!count.compare_exchange_weak(current, current + 1u, std::memory_order_acquire, std::memory_order_relaxed));
+			return true;
+		}
+
+		inline bool decrease(const Object*)
+		{
+			if (count.load(std::memory_order_relaxed) >= IMMORTAL)
+				return false;
+			return count.fetch_sub(1u, std::memory_order_acq_rel) == 1u;
+		}
+
+		inline bool is_zero() const
+		{
+			return count.load(std::memory_order_acquire) == 0u;
+		}
+
+		inline uint32_t load() const
+		{
+			return count.load(std::memory_order_relaxed);
+		}
+
+		inline bool is_immortal() const
+		{
+			return count.load(std::memory_order_relaxed) >= IMMORTAL;
+		}
+
+		// (!) : chỉ gọi trước khi Object được chia sẻ cho thread khác.
+		inline void make_immortal()
+		{
+			count.store(IMMORTAL, std::memory_order_release);
+		}
+	};
+
+#elif PYCPP_REFCOUNT_MODE == PYCPP_REFCOUNT_BIASED
+
+	/*
+	Biased Reference Counting :
+	- "owner" : định danh thread chủ ( thread tạo Object ), 0 nếu Object không còn thread chủ.
+	- "biased" : tham chiếu của thread chủ, chỉ thread chủ ghi.
+	- "shared" : (count << 2) | QUEUED | MERGED, tham chiếu của các thread khác, có thể âm.
+
+	Tổng tham chiếu = biased + count.
+	- Khi "biased" về 0, thread chủ gộp ( merge ) : đặt MERGED và bỏ quyền chủ, mọi thao tác sau dùng "shared".
+	- Khi thread khác làm "count" âm trước khi gộp, Object được đưa vào hàng đợi của thread chủ ( QUEUED ).
+	  Thread chủ gộp hàng đợi khi gọi "merge_biased_references()" hoặc khi kết thúc.
+	- Object tạm ( chưa từng được tham chiếu ) chỉ được SAFE giải phóng bởi thread chủ.
+	- Object bất tử có "owner" = IMMORTAL_OWNER, mọi thread bỏ qua tăng / giảm tham chiếu.
+	*/
+
+	// Định danh của thread hiện tại, 0 nếu chưa được cấp.
+	extern thread_local uint32_t __biased_thread_tag;
+
+	// Cấp định danh và hàng đợi cho thread hiện tại.
+	uint32_t __biased_register_thread();
+
+	inline uint32_t biased_thread_tag()
+	{
+		auto tag = __biased_thread_tag;
+		return tag != 0u ? tag : __biased_register_thread();
+	}
+
+	class __RefCount final
+	{
+		std::atomic<uint32_t> owner;
+		std::atomic<uint32_t> biased;
+		std::atomic<int32_t> shared;
+
+		friend bool __biased_release_owner(__RefCount& counter, const Object* object);
+		friend bool __biased_release_shared(__RefCount& counter, const Object* object);
+		friend bool __biased_merge(__RefCount& counter);
+		friend bool __biased_try_release(__RefCount& counter, int32_t& state, bool& released);
+		friend bool __biased_try_increase(__RefCount& counter);
+
+	public:
+		static constexpr const int32_t MERGED = 0b01;
+		static constexpr const int32_t QUEUED = 0b10;
+		static constexpr const int32_t ONE = 0b100;
+		static constexpr const uint32_t IMMORTAL_OWNER = UINT32_MAX;
+
+		inline __RefCount() : owner(biased_thread_tag()), biased(0u), shared(0) {}
+		inline __RefCount(const __RefCount&) : __RefCount() {}
+		inline __RefCount& operator=(const __RefCount&) { return *this; }
+
+		inline void increase()
+		{
+			auto owner_tag = owner.load(std::memory_order_relaxed);
+			if (owner_tag == biased_thread_tag())
+				biased.store(biased.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+			else if (owner_tag != IMMORTAL_OWNER)
+				shared.fetch_add(ONE, std::memory_order_relaxed);
+		}
+
+		inline bool try_increase()
+		{
+			return __biased_try_increase(*this);
+		}
+
+		inline bool decrease(const Object* object)
+		{
+			auto owner_tag = owner.load(std::memory_order_relaxed);
+			if (owner_tag == biased_thread_tag())
+			{
+				auto n_biased = biased.load(std::memory_order_relaxed) - 1u;
+				biased.store(n_biased, std::memory_order_relaxed);
+				if (n_biased != 0u)
+					return false;
+				return __biased_release_owner(*this, object);
+			}
+			if (owner_tag == IMMORTAL_OWNER)
+				return false;
+			return __biased_release_shared(*this, object);
+		}
+
+		inline bool is_zero() const
+		{
+			auto state = shared.load(std::memory_order_acquire);
+			if ((state & QUEUED) || (state >> 2) != 0)
+				return false;
+			if (state & MERGED)
+				return true;
+			return owner.load(std::memory_order_relaxed) == biased_thread_tag() &&
+				biased.load(std::memory_order_relaxed) == 0u;
+		}
+
+		inline uint32_t load() const
+		{
+			if (is_immortal())
+				return 1u << 31;
+
+			auto state = shared.load(std::memory_order_relaxed);
+			auto count = (state & MERGED) ? 0 : int32_t(biased.load(std::memory_order_relaxed));
+			return uint32_t(count + (state >> 2));
+		}
+
+		inline bool is_immortal() const
+		{
+			return owner.load(std::memory_order_relaxed) == IMMORTAL_OWNER;
+		}
+
+		// (!) : chỉ gọi trước khi Object được chia sẻ cho thread khác.
+		inline void make_immortal()
+		{
+			biased.store(0u, std::memory_order_relaxed);
+			shared.store(ONE | MERGED, std::memory_order_relaxed);
+			owner.store(IMMORTAL_OWNER, std::memory_order_release);
+		}
+	};
+
+	// Thread chủ vừa đưa "biased" về 0.
+	bool __biased_release_owner(__RefCount& counter, const Object* object);
+
+	// Thread khác giảm tham chiếu.
+	bool __biased_release_shared(__RefCount& counter, const Object* object);
+
+	// Tăng tham chiếu nếu tổng tham chiếu khác 0.
+	bool __biased_try_increase(__RefCount& counter);
+
+	// Gộp "biased" vào "shared", trả về "true" nếu tổng tham chiếu bằng 0.
+	// (!) : chỉ gọi bởi thread chủ hoặc khi thread chủ đã kết thúc.
+	bool __biased_merge(__RefCount& counter);
+
+#else
+#error "PYCPP_REFCOUNT_MODE must be PYCPP_REFCOUNT_PLAIN, PYCPP_REFCOUNT_ATOMIC or PYCPP_REFCOUNT_BIASED"
+#endif
+
+	// Gộp các Object trong hàng đợi của thread hiện tại ( chế độ BIASED ), giải phóng Object không còn tham chiếu.
+	// Gọi định kỳ tại các điểm an toàn của worker thread, không làm gì ở các chế độ khác.
+	// (!) : không gọi khi đang giữ Object đã DEREF nhưng chưa SAFE ( ví dụ kết quả của "pop" ).
+	void merge_biased_references();
+
+#pragma endregion
+
+}
\ No newline at end of file
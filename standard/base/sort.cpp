@@ -0,0 +1,1277 @@
+#include "sort.hpp"
+#include "algo.hpp"
+#include "numeric.hpp"
+#include "primitive.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace pycpp
+{
+
+#pragma region Supported Sort
+
+	static inline bool sort_less(Object* a, Object* b)
+	{
+		return a->rich_compare(b) < 0;
+	}
+
+	// Giữ một phần tử ngoài mảng, luôn đặt nó vào "hole" khi bị hủy ( kể cả khi "rich_compare" ném lỗi ).
+	struct __SortHole
+	{
+		Object** hole;
+		Object* value;
+
+		~__SortHole()
+		{
+			*hole = value;
+		}
+	};
+
+	// Chèn nhị phân ổn định các phần tử [start, len) vào đoạn đã sắp xếp [0, start).
+	static void binary_insertion(Object** __array, u32 len, u32 start)
+	{
+		for (u32 i = pycpp::max(start, 1u); i < len; ++i)
+		{
+			Object* pivot = __array[i];
+
+			// Vị trí sau phần tử cuối cùng <= "pivot"
+			u32 left = 0u, right = i;
+			while (left < right)
+			{
+				u32 mid = (left + right) >> 1;
+				if (sort_less(pivot, __array[mid]))
+					right = mid;
+				else
+					left = mid + 1u;
+			}
+
+			std::memmove(__array + left + 1u, __array + left, sizeof(Object*) * (i - left));
+			__array[left] = pivot;
+		}
+	}
+
+	static inline void reverse_range(Object** begin, Object** end)
+	{
+		while (begin < --end)
+			pycpp::swap(*begin++, *end);
+	}
+
+#pragma endregion
+
+#pragma region Timsort
+
+	// Đoạn ngắn hơn được mở rộng bằng chèn nhị phân.
+	constexpr const u32 TIMSORT_MIN_MERGE = 64u;
+
+	// Số lần liên tiếp một bên thắng trước khi chuyển sang chế độ "galloping".
+	constexpr const u32 TIMSORT_MIN_GALLOP = 7u;
+
+	struct __TimSort
+	{
+		struct Run
+		{
+			Object** base;
+			u32 len;
+		};
+
+		Object** buffer = nullptr;
+		u32 buffer_capacity = 0u;
+		u32 min_gallop = TIMSORT_MIN_GALLOP;
+
+		// Chiều dài các đoạn tăng ít nhất theo dãy Fibonacci : 64 đoạn là đủ với u32.
+		Run runs[64];
+		u32 count = 0u;
+
+		~__TimSort()
+		{
+			delete[] buffer;
+		}
+
+		Object** ensure_buffer(u32 need)
+		{
+			if (need > buffer_capacity)
+			{
+				delete[] buffer;
+				buffer_capacity = pycpp::max(need, buffer_capacity << 1);
+				buffer = new Object*[buffer_capacity];
+			}
+			return buffer;
+		}
+
+		// Độ dài tối thiểu của một đoạn, trong [32, 64] và "len / min_run" gần lũy thừa của 2.
+		static u32 min_run(u32 len)
+		{
+			u32 r = 0u;
+			while (len >= TIMSORT_MIN_MERGE)
+			{
+				r |= len & 1u;
+				len >>= 1;
+			}
+			return len + r;
+		}
+
+		// Độ dài đoạn tăng ( không giảm ) hoặc giảm ngặt bắt đầu từ "begin", đoạn giảm được đảo ngược.
+		static u32 count_run(Object** begin, u32 len)
+		{
+			if (len == 1u)
+				return 1u;
+
+			u32 i = 2u;
+			if (sort_less(begin[1], begin[0]))
+			{
+				// Giảm ngặt : đảo ngược vẫn giữ tính ổn định
+				while (i < len && sort_less(begin[i], begin[i - 1u]))
+					++i;
+				reverse_range(begin, begin + i);
+			}
+			else
+			{
+				while (i < len && sort_less(begin[i], begin[i - 1u]) == false)
+					++i;
+			}
+
+			return i;
+		}
+
+		// Vị trí k sao cho a[k - 1] < key <= a[k], bắt đầu dò từ "hint".
+		static u32 gallop_left(Object* key, Object** a, u32 n, u32 hint)
+		{
+			i64 last_offset = 0, offset = 1;
+
+			if (sort_less(a[hint], key))
+			{
+				// a[hint] < key : dò sang phải
+				i64 max_offset = i64(n) - hint;
+				while (offset < max_offset && sort_less(a[hint + offset], key))
+				{
+					last_offset = offset;
+					offset = (offset << 1) + 1;
+				}
+				if (offset > max_offset)
+					offset = max_offset;
+
+				last_offset += hint;
+				offset += hint;
+			}
+			else
+			{
+				// key <= a[hint] : dò sang trái
+				i64 max_offset = i64(hint) + 1;
+				while (offset < max_offset && sort_less(a[hint - offset], key) == false)
+				{
+					last_offset = offset;
+					offset = (offset << 1) + 1;
+				}
+				if (offset > max_offset)
+					offset = max_offset;
+
+				i64 k = last_offset;
+				last_offset = i64(hint) - offset;
+				offset = i64(hint) - k;
+			}
+
+			// a[last_offset] < key <= a[offset]
+			++last_offset;
+			while (last_offset < offset)
+			{
+				i64 mid = last_offset + ((offset - last_offset) >> 1);
+				if (sort_less(a[mid], key))
+					last_offset = mid + 1;
+				else
+					offset = mid;
+			}
+			return u32(offset);
+		}
+
+		// Vị trí k sao cho a[k - 1] <= key < a[k], bắt đầu dò từ "hint".
+		static u32 gallop_right(Object* key, Object** a, u32 n, u32 hint)
+		{
+			i64 last_offset = 0, offset = 1;
+
+			if (sort_less(key, a[hint]))
+			{
+				// key < a[hint] : dò sang trái
+				i64 max_offset = i64(hint) + 1;
+				while (offset < max_offset && sort_less(key, a[hint - offset]))
+				{
+					last_offset = offset;
+					offset = (offset << 1) + 1;
+				}
+				if (offset > max_offset)
+					offset = max_offset;
+
+				i64 k = last_offset;
+				last_offset = i64(hint) - offset;
+				offset = i64(hint) - k;
+			}
+			else
+			{
+				// a[hint] <= key : dò sang phải
+				i64 max_offset = i64(n) - hint;
+				while (offset < max_offset && sort_less(key, a[hint + offset]) == false)
+				{
+					last_offset = offset;
+					offset = (offset << 1) + 1;
+				}
+				if (offset > max_offset)
+					offset = max_offset;
+
+				last_offset += hint;
+				offset += hint;
+			}
+
+			// a[last_offset] <= key < a[offset]
+			++last_offset;
+			while (last_offset < offset)
+			{
+				i64 mid = last_offset + ((offset - last_offset) >> 1);
+				if (sort_less(key, a[mid]))
+					offset = mid;
+				else
+					last_offset = mid + 1;
+			}
+			return u32(offset);
+		}
+
+		// Chép phần còn lại trong bộ nhớ phụ về mảng khi kết thúc gộp ( kể cả khi ném lỗi ).
+		struct MergeGuard
+		{
+			Object**& dest;
+			Object**& source;
+			u32& count;
+
+			~MergeGuard()
+			{
+				if (count)
+					std::memcpy(dest, source, sizeof(Object*) * count);
+			}
+		};
+
+		// Gộp hai đoạn liền kề a ( na ) và b ( nb ) với na <= nb, chép a sang bộ nhớ phụ.
+		// Điều kiện : b[0] < a[0] và a[na - 1] > b[nb - 1].
+		void merge_low(Object** a, u32 na, Object** b, u32 nb)
+		{
+			Object** dest = a;
+			Object** pa = ensure_buffer(na);
+			Object** pb = b;
+			std::memcpy(pa, a, sizeof(Object*) * na);
+
+			MergeGuard guard{ dest, pa, na };
+
+			*dest++ = *pb++;
+			if (--nb == 0u)
+				return;
+			if (na == 1u)
+			{
+				copy_b_then_a(dest, pb, nb, pa, na);
+				return;
+			}
+
+			u32 gallop = min_gallop;
+			while (true)
+			{
+				u32 count_a = 0u, count_b = 0u;
+
+				// Từng phần tử, đến khi một bên thắng liên tiếp "gallop" lần
+				do
+				{
+					if (sort_less(*pb, *pa))
+					{
+						*dest++ = *pb++;
+						++count_b;
+						count_a = 0u;
+						if (--nb == 0u)
+							return;
+					}
+					else
+					{
+						*dest++ = *pa++;
+						++count_a;
+						count_b = 0u;
+						if (--na == 1u)
+						{
+							copy_b_then_a(dest, pb, nb, pa, na);
+							return;
+						}
+					}
+				} while ((count_a | count_b) < gallop);
+
+				// Galloping : tìm cả khối bằng tìm kiếm nhị phân mở rộng
+				++gallop;
+				do
+				{
+					gallop -= gallop > 1u;
+					min_gallop = gallop;
+
+					u32 k = gallop_right(*pb, pa, na, 0u);
+					count_a = k;
+					if (k)
+					{
+						std::memcpy(dest, pa, sizeof(Object*) * k);
+						dest += k;
+						pa += k;
+						na -= k;
+						if (na == 1u)
+						{
+							copy_b_then_a(dest, pb, nb, pa, na);
+							return;
+						}
+						// na == 0 chỉ xảy ra khi phép so sánh không nhất quán
+						if (na == 0u)
+							return;
+					}
+
+					*dest++ = *pb++;
+					if (--nb == 0u)
+						return;
+
+					k = gallop_left(*pa, pb, nb, 0u);
+					count_b = k;
+					if (k)
+					{
+						std::memmove(dest, pb, sizeof(Object*) * k);
+						dest += k;
+						pb += k;
+						nb -= k;
+						if (nb == 0u)
+							return;
+					}
+
+					*dest++ = *pa++;
+					if (--na == 1u)
+					{
+						copy_b_then_a(dest, pb, nb, pa, na);
+						return;
+					}
+				} while (count_a >= TIMSORT_MIN_GALLOP || count_b >= TIMSORT_MIN_GALLOP);
+
+				++gallop;
+				min_gallop = gallop;
+			}
+		}
+
+		// Phần tử cuối của a lớn hơn toàn bộ phần còn lại của b.
+		static void copy_b_then_a(Object** dest, Object** pb, u32 nb, Object** pa, u32& na)
+		{
+			std::memmove(dest, pb, sizeof(Object*) * nb);
+			dest[nb] = *pa;
+			na = 0u;
+		}
+
+		// Chép phần còn lại của b ( trong bộ nhớ phụ ) về cuối vùng gộp.
+		struct MergeHighGuard
+		{
+			Object**& dest;
+			Object** base_b;
+			u32& count;
+
+			~MergeHighGuard()
+			{
+				if (count)
+					std::memcpy(dest - (count - 1u), base_b, sizeof(Object*) * count);
+			}
+		};
+
+		// Gộp hai đoạn liền kề a ( na ) và b ( nb ) với na > nb, chép b sang bộ nhớ phụ, gộp từ cuối.
+		// Điều kiện : b[0] < a[0] và a[na - 1] > b[nb - 1].
+		void merge_high(Object** a, u32 na, Object** b, u32 nb)
+		{
+			Object** base_a = a;
+			Object** base_b = ensure_buffer(nb);
+			std::memcpy(base_b, b, sizeof(Object*) * nb);
+
+			Object** dest = b + nb - 1u;
+			Object** pa = a + na - 1u;
+			Object** pb = base_b + nb - 1u;
+
+			MergeHighGuard guard{ dest, base_b, nb };
+
+			*dest-- = *pa--;
+			if (--na == 0u)
+				return;
+			if (nb == 1u)
+			{
+				copy_a_then_b(dest, pa, na, pb, nb);
+				return;
+			}
+
+			u32 gallop = min_gallop;
+			while (true)
+			{
+				u32 count_a = 0u, count_b = 0u;
+
+				do
+				{
+					if (sort_less(*pb, *pa))
+					{
+						*dest-- = *pa--;
+						++count_a;
+						count_b = 0u;
+						if (--na == 0u)
+							return;
+					}
+					else
+					{
+						*dest-- = *pb--;
+						++count_b;
+						count_a = 0u;
+						if (--nb == 1u)
+						{
+							copy_a_then_b(dest, pa, na, pb, nb);
+							return;
+						}
+					}
+				} while ((count_a | count_b) < gallop);
+
+				++gallop;
+				do
+				{
+					gallop -= gallop > 1u;
+					min_gallop = gallop;
+
+					u32 k = na - gallop_right(*pb, base_a, na, na - 1u);
+					count_a = k;
+					if (k)
+					{
+						dest -= k;
+						pa -= k;
+						std::memmove(dest + 1, pa + 1, sizeof(Object*) * k);
+						na -= k;
+						if (na == 0u)
+							return;
+					}
+
+					*dest-- = *pb--;
+					if (--nb == 1u)
+					{
+						copy_a_then_b(dest, pa, na, pb, nb);
+						return;
+					}
+
+					k = nb - gallop_left(*pa, base_b, nb, nb - 1u);
+					count_b = k;
+					if (k)
+					{
+						dest -= k;
+						pb -= k;
+						std::memcpy(dest + 1, pb + 1, sizeof(Object*) * k);
+						nb -= k;
+						if (nb == 1u)
+						{
+							copy_a_then_b(dest, pa, na, pb, nb);
+							return;
+						}
+						// nb == 0 chỉ xảy ra khi phép so sánh không nhất quán
+						if (nb == 0u)
+							return;
+					}
+
+					*dest-- = *pa--;
+					if (--na == 0u)
+						return;
+				} while (count_a >= TIMSORT_MIN_GALLOP || count_b >= TIMSORT_MIN_GALLOP);
+
+				++gallop;
+				min_gallop = gallop;
+			}
+		}
+
+		// Phần tử đầu của b nhỏ hơn toàn bộ phần còn lại của a.
+		static void copy_a_then_b(Object** dest, Object** pa, u32 na, Object** pb, u32& nb)
+		{
+			dest -= na;
+			pa -= na;
+			std::memmove(dest + 1, pa + 1, sizeof(Object*) * na);
+			*dest = *pb;
+			nb = 0u;
+		}
+
+		// Gộp đoạn thứ "i" và "i + 1" trên ngăn xếp.
+		void merge_at(u32 i)
+		{
+			Object** a = runs[i].base;
+			u32 na = runs[i].len;
+			Object** b = runs[i + 1u].base;
+			u32 nb = runs[i + 1u].len;
+
+			runs[i].len = na + nb;
+			if (i + 3u == count)
+				runs[i + 1u] = runs[i + 2u];
+			--count;
+
+			// Bỏ qua phần đầu của a đã nằm đúng chỗ
+			u32 k = gallop_right(*b, a, na, 0u);
+			a += k;
+			na -= k;
+			if (na == 0u)
+				return;
+
+			// Bỏ qua phần cuối của b đã nằm đúng chỗ
+			nb = gallop_left(a[na - 1u], b, nb, nb - 1u);
+			if (nb == 0u)
+				return;
+
+			if (na <= nb)
+				merge_low(a, na, b, nb);
+			else
+				merge_high(a, na, b, nb);
+		}
+
+		// Giữ bất biến của ngăn xếp : len[i - 2] > len[i - 1] + len[i] và len[i - 1] > len[i].
+		void merge_collapse()
+		{
+			while (count > 1u)
+			{
+				u32 i = count - 2u;
+				if ((i > 0u && runs[i - 1u].len <= runs[i].len + runs[i + 1u].len) ||
+					(i > 1u && runs[i - 2u].len <= runs[i - 1u].len + runs[i].len))
+				{
+					if (runs[i - 1u].len < runs[i + 1u].len)
+						--i;
+					merge_at(i);
+				}
+				else if (runs[i].len <= runs[i + 1u].len)
+					merge_at(i);
+				else
+					break;
+			}
+		}
+
+		void merge_force_collapse()
+		{
+			while (count > 1u)
+			{
+				u32 i = count - 2u;
+				if (i > 0u && runs[i - 1u].len < runs[i + 1u].len)
+					--i;
+				merge_at(i);
+			}
+		}
+	};
+
+	void tim_sort(Object** __array, u32 len)
+	{
+		if (len < 2u)
+			return;
+
+		// Mảng nhỏ : một đoạn và chèn nhị phân
+		if (len < TIMSORT_MIN_MERGE)
+		{
+			binary_insertion(__array, len, __TimSort::count_run(__array, len));
+			return;
+		}
+
+		__TimSort state;
+		u32 min_run = __TimSort::min_run(len);
+
+		Object** cur = __array;
+		u32 remaining = len;
+		while (remaining)
+		{
+			u32 n = __TimSort::count_run(cur, remaining);
+			if (n < min_run)
+			{
+				u32 force = pycpp::min(remaining, min_run);
+				binary_insertion(cur, force, n);
+				n = force;
+			}
+
+			state.runs[state.count++] = { cur, n };
+			state.merge_collapse();
+
+			cur += n;
+			remaining -= n;
+		}
+
+		state.merge_force_collapse();
+	}
+
+#pragma endregion
+
+#pragma region Pattern-defeating Quicksort
+
+	// Đoạn ngắn hơn được sắp xếp bằng chèn trực tiếp.
+	constexpr const i64 PDQSORT_INSERTION_THRESHOLD = 24;
+
+	// Đoạn dài hơn chọn chốt bằng trung vị của 9 ( "ninther" ).
+	constexpr const i64 PDQSORT_NINTHER_THRESHOLD = 128;
+
+	// Số phần tử tối đa được dịch chuyển khi thử chèn trên đoạn có vẻ đã sắp xếp.
+	constexpr const i64 PDQSORT_PARTIAL_INSERTION_LIMIT = 8;
+
+	struct __PdqSort
+	{
+		// Chèn trực tiếp [begin, end).
+		static void insertion_sort(Object** begin, Object** end)
+		{
+			if (begin == end)
+				return;
+
+			for (Object** cur = begin + 1; cur != end; ++cur)
+			{
+				Object** sift = cur;
+				Object** sift_1 = cur - 1;
+
+				if (sort_less(*sift, *sift_1))
+				{
+					__SortHole hole{ sift, *sift };
+					do
+					{
+						*hole.hole-- = *sift_1;
+					} while (hole.hole != begin && sort_less(hole.value, *--sift_1));
+				}
+			}
+		}
+
+		// Như "insertion_sort" nhưng không kiểm tra biên trái.
+		// Điều kiện : *(begin - 1) không lớn hơn phần tử nào trong [begin, end).
+		static void unguarded_insertion_sort(Object** begin, Object** end)
+		{
+			if (begin == end)
+				return;
+
+			for (Object** cur = begin + 1; cur != end; ++cur)
+			{
+				Object** sift = cur;
+				Object** sift_1 = cur - 1;
+
+				if (sort_less(*sift, *sift_1))
+				{
+					__SortHole hole{ sift, *sift };
+					do
+					{
+						*hole.hole-- = *sift_1;
+					} while (sort_less(hole.value, *--sift_1));
+				}
+			}
+		}
+
+		// Thử chèn trực tiếp, dừng lại ( trả về false ) khi đã dịch chuyển quá nhiều phần tử.
+		static bool partial_insertion_sort(Object** begin, Object** end)
+		{
+			if (begin == end)
+				return true;
+
+			i64 limit = 0;
+			for (Object** cur = begin + 1; cur != end; ++cur)
+			{
+				if (limit > PDQSORT_PARTIAL_INSERTION_LIMIT)
+					return false;
+
+				Object** sift = cur;
+				Object** sift_1 = cur - 1;
+
+				if (sort_less(*sift, *sift_1))
+				{
+					__SortHole hole{ sift, *sift };
+					do
+					{
+						*hole.hole-- = *sift_1;
+					} while (hole.hole != begin && sort_less(hole.value, *--sift_1));
+
+					limit += cur - hole.hole;
+				}
+			}
+
+			return true;
+		}
+
+		static inline void sort2(Object** a, Object** b)
+		{
+			if (sort_less(*b, *a))
+				pycpp::swap(*a, *b);
+		}
+
+		static inline void sort3(Object** a, Object** b, Object** c)
+		{
+			sort2(a, b);
+			sort2(b, c);
+			sort2(a, b);
+		}
+
+		// Phân hoạch quanh chốt *begin : [ < chốt ] chốt [ >= chốt ].
+		// Trả về vị trí chốt, "already_partitioned" là true nếu không cần hoán đổi phần tử nào.
+		static Object** partition_right(Object** begin, Object** end, bool& already_partitioned)
+		{
+			Object* pivot = *begin;
+			Object** first = begin;
+			Object** last = end;
+
+			// Có ít nhất một phần tử >= chốt ( trung vị của 3 ) nên không cần kiểm tra biên
+			while (sort_less(*++first, pivot));
+
+			// Phần tử đầu tiên đã >= chốt : cần kiểm tra biên
+			if (first - 1 == begin)
+				while (first < last && sort_less(*--last, pivot) == false);
+			else
+				while (sort_less(*--last, pivot) == false);
+
+			already_partitioned = first >= last;
+
+			while (first < last)
+			{
+				pycpp::swap(*first, *last);
+				while (sort_less(*++first, pivot));
+				while (sort_less(*--last, pivot) == false);
+			}
+
+			Object** pivot_position = first - 1;
+			*begin = *pivot_position;
+			*pivot_position = pivot;
+			return pivot_position;
+		}
+
+		// Phân hoạch quanh chốt *begin : [ <= chốt ] chốt [ > chốt ].
+		// Dùng khi chốt bằng phần tử ngay trước đoạn : các phần tử bằng chốt không cần sắp xếp tiếp.
+		static Object** partition_left(Object** begin, Object** end)
+		{
+			Object* pivot = *begin;
+			Object** first = begin;
+			Object** last = end;
+
+			while (sort_less(pivot, *--last));
+
+			if (last + 1 == end)
+				while (first < last && sort_less(pivot, *++first) == false);
+			else
+				while (sort_less(pivot, *++first) == false);
+
+			while (first < last)
+			{
+				pycpp::swap(*first, *last);
+				while (sort_less(pivot, *--last));
+				while (sort_less(pivot, *++first) == false);
+			}
+
+			Object** pivot_position = last;
+			*begin = *pivot_position;
+			*pivot_position = pivot;
+			return pivot_position;
+		}
+
+		// Chỉ hoán đổi phần tử : mảng luôn chứa đủ phần tử khi "rich_compare" ném lỗi.
+		static void sift_down(Object** heap, i64 root, i64 size)
+		{
+			while (true)
+			{
+				i64 child = (root << 1) + 1;
+				if (child >= size)
+					return;
+
+				if (child + 1 < size && sort_less(heap[child], heap[child + 1]))
+					++child;
+
+				if (sort_less(heap[root], heap[child]) == false)
+					return;
+
+				pycpp::swap(heap[root], heap[child]);
+				root = child;
+			}
+		}
+
+		static void heap_sort(Object** begin, Object** end)
+		{
+			i64 size = end - begin;
+
+			for (i64 i = size / 2 - 1; i >= 0; --i)
+				sift_down(begin, i, size);
+
+			for (i64 i = size - 1; i > 0; --i)
+			{
+				pycpp::swap(begin[0], begin[i]);
+				sift_down(begin, 0, i);
+			}
+		}
+
+		// Xáo trộn vài phần tử để phá mẫu dữ liệu gây phân hoạch lệch.
+		static void break_patterns(Object** begin, Object** pivot_position, Object** end)
+		{
+			i64 l_size = pivot_position - begin;
+			i64 r_size = end - (pivot_position + 1);
+
+			if (l_size >= PDQSORT_INSERTION_THRESHOLD)
+			{
+				pycpp::swap(begin[0], begin[l_size / 4]);
+				pycpp::swap(pivot_position[-1], pivot_position[-l_size / 4]);
+
+				if (l_size > PDQSORT_NINTHER_THRESHOLD)
+				{
+					pycpp::swap(begin[1], begin[l_size / 4 + 1]);
+					pycpp::swap(begin[2], begin[l_size / 4 + 2]);
+					pycpp::swap(pivot_position[-2], pivot_position[-(l_size / 4 + 1)]);
+					pycpp::swap(pivot_position[-3], pivot_position[-(l_size / 4 + 2)]);
+				}
+			}
+
+			if (r_size >= PDQSORT_INSERTION_THRESHOLD)
+			{
+				pycpp::swap(pivot_position[1], pivot_position[1 + r_size / 4]);
+				pycpp::swap(end[-1], end[-r_size / 4]);
+
+				if (r_size > PDQSORT_NINTHER_THRESHOLD)
+				{
+					pycpp::swap(pivot_position[2], pivot_position[2 + r_size / 4]);
+					pycpp::swap(pivot_position[3], pivot_position[3 + r_size / 4]);
+					pycpp::swap(end[-2], end[-(1 + r_size / 4)]);
+					pycpp::swap(end[-3], end[-(2 + r_size / 4)]);
+				}
+			}
+		}
+
+		// "bad_allowed" : số lần phân hoạch lệch còn cho phép trước khi chuyển sang heapsort.
+		// "leftmost" : đoạn không có phần tử nào ở bên trái ( không dùng được chèn không kiểm tra biên ).
+		static void loop(Object** begin, Object** end, i32 bad_allowed, bool leftmost)
+		{
+			while (true)
+			{
+				i64 size = end - begin;
+
+				if (size < PDQSORT_INSERTION_THRESHOLD)
+				{
+					if (leftmost)
+						insertion_sort(begin, end);
+					else
+						unguarded_insertion_sort(begin, end);
+					return;
+				}
+
+				// Đưa chốt về *begin
+				i64 s2 = size / 2;
+				if (size > PDQSORT_NINTHER_THRESHOLD)
+				{
+					sort3(begin, begin + s2, end - 1);
+					sort3(begin + 1, begin + (s2 - 1), end - 2);
+					sort3(begin + 2, begin + (s2 + 1), end - 3);
+					sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1));
+					pycpp::swap(*begin, *(begin + s2));
+				}
+				else
+					sort3(begin + s2, begin, end - 1);
+
+				// Chốt bằng phần tử ngay trước đoạn ( chốt của lần phân hoạch trước ) :
+				// mọi phần tử bằng chốt đã đúng vị trí
+				if (leftmost == false && sort_less(*(begin - 1), *begin) == false)
+				{
+					begin = partition_left(begin, end) + 1;
+					continue;
+				}
+
+				bool already_partitioned;
+				Object** pivot_position = partition_right(begin, end, already_partitioned);
+
+				i64 l_size = pivot_position - begin;
+				i64 r_size = end - (pivot_position + 1);
+
+				if (l_size < size / 8 || r_size < size / 8)
+				{
+					if (--bad_allowed == 0)
+					{
+						heap_sort(begin, end);
+						return;
+					}
+
+					break_patterns(begin, pivot_position, end);
+				}
+				else if (already_partitioned &&
+					partial_insertion_sort(begin, pivot_position) &&
+					partial_insertion_sort(pivot_position + 1, end))
+				{
+					// Đoạn đã sắp xếp ( hoặc gần như vậy )
+					return;
+				}
+
+				// Đệ quy bên trái, lặp bên phải
+				loop(begin, pivot_position, bad_allowed, leftmost);
+				begin = pivot_position + 1;
+				leftmost = false;
+			}
+		}
+	};
+
+	void pdq_sort(Object** __array, u32 len)
+	{
+		if (len < 2u)
+			return;
+
+		// log2(len)
+		i32 bad_allowed = 0;
+		for (u32 n = len; n > 1u; n >>= 1)
+			++bad_allowed;
+
+		__PdqSort::loop(__array, __array + len, bad_allowed, true);
+	}
+
+#pragma endregion
+
+#pragma region Parallel Sort
+
+	// Số phần tử tối thiểu của mỗi thread.
+	constexpr const u32 PARALLEL_SORT_MIN_CHUNK = 1u << 14;
+
+	static u32 __sort_threads = PYCPP_SORT_THREADS;
+	static u32 __parallel_sort_threshold = PYCPP_PARALLEL_SORT_THRESHOLD;
+
+	void sort_set_threads(u32 threads)
+	{
+		__sort_threads = threads;
+	}
+
+	void sort_set_parallel_threshold(u32 threshold)
+	{
+		__parallel_sort_threshold = threshold;
+	}
+
+	static u32 parallel_thread_count(u32 threads, u32 len)
+	{
+		if (threads == 0u)
+			threads = __sort_threads;
+		if (threads == 0u)
+			threads = pycpp::max(1u, u32(std::thread::hardware_concurrency()));
+
+		return pycpp::max(1u, pycpp::min(threads, len / PARALLEL_SORT_MIN_CHUNK));
+	}
+
+	// Chạy "task(index)" với mọi index trong [0, count) trên "threads" thread ( kể cả thread gọi ).
+	// Lỗi đầu tiên được ném lại trên thread gọi sau khi mọi thread kết thúc.
+	template <typename Task>
+	static void run_parallel(u32 count, u32 threads, Task&& task)
+	{
+		std::atomic<u32> next{ 0u };
+		std::exception_ptr error;
+		std::mutex error_lock;
+
+		auto worker = [&]()
+			{
+				for (u32 index = next++; index < count; index = next++)
+				{
+					try
+					{
+						task(index);
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(error_lock);
+						if (error == nullptr)
+							error = std::current_exception();
+						next = count;
+					}
+				}
+			};
+
+		std::vector<std::thread> pool;
+		for (u32 i = 1u; i < threads && i < count; ++i)
+			pool.emplace_back(worker);
+
+		worker();
+		for (auto& thread : pool)
+			thread.join();
+
+		if (error)
+			std::rethrow_exception(error);
+	}
+
+	// Số phần tử của "a" trong "k" phần tử đầu tiên khi gộp ổn định "a" và "b".
+	static u32 merge_split(Object** a, u32 na, Object** b, u32 nb, u32 k)
+	{
+		u32 low = k > nb ? k - nb : 0u;
+		u32 high = pycpp::min(k, na);
+
+		while (low < high)
+		{
+			u32 i = (low + high) >> 1;
+
+			// a[i] đứng trước b[k - i - 1] ( bằng nhau thì "a" trước ) : cần thêm phần tử của "a"
+			if (sort_less(b[k - i - 1u], a[i]) == false)
+				low = i + 1u;
+			else
+				high = i;
+		}
+
+		return low;
+	}
+
+	// Gộp ổn định "a" và "b" vào "dest".
+	static void merge_into(Object** a, u32 na, Object** b, u32 nb, Object** dest)
+	{
+		Object** a_end = a + na;
+		Object** b_end = b + nb;
+
+		while (a != a_end && b != b_end)
+			*dest++ = sort_less(*b, *a) ? *b++ : *a++;
+
+		std::memcpy(dest, a, sizeof(Object*) * (a_end - a));
+		dest += a_end - a;
+		std::memcpy(dest, b, sizeof(Object*) * (b_end - b));
+	}
+
+	// Giải phóng bộ nhớ phụ, chép mảng về vị trí ban đầu nếu kết quả ( hoặc trạng thái khi lỗi ) nằm trong bộ nhớ phụ.
+	struct __ParallelSort
+	{
+		Object** __array;
+		u32 len;
+
+		Object** buffer = nullptr;
+		Object** source = nullptr;
+
+		// Biên của các đoạn đã sắp xếp trong "source".
+		u32* bounds = nullptr;
+
+		~__ParallelSort()
+		{
+			if (source != __array)
+				std::memcpy(__array, source, sizeof(Object*) * len);
+
+			delete[] buffer;
+			delete[] bounds;
+		}
+	};
+
+	void parallel_sort(Object** __array, u32 len, u32 threads)
+	{
+		threads = parallel_thread_count(threads, len);
+		if (threads <= 1u)
+		{
+			tim_sort(__array, len);
+			return;
+		}
+
+		// "type_index" ghi vào Object ở lần gọi đầu tiên : xác định trước trên thread gọi
+		for (u32 i = 0u; i < len; ++i)
+			__array[i]->type_index();
+
+		__ParallelSort state{ __array, len };
+		state.source = __array;
+
+		u32 runs = threads;
+		state.bounds = new u32[runs + 1u];
+		for (u32 i = 0u; i <= runs; ++i)
+			state.bounds[i] = u32(u64(len) * i / runs);
+
+		// Mỗi thread sắp xếp một đoạn
+		u32* bounds = state.bounds;
+		run_parallel(runs, threads, [&](u32 i)
+			{
+				tim_sort(__array + bounds[i], bounds[i + 1u] - bounds[i]);
+			});
+
+		// Gộp từng cặp đoạn liền kề từ "source" sang "target", đổi vai trò sau mỗi vòng
+		state.buffer = new Object*[len];
+		Object** target = state.buffer;
+
+		while (runs > 1u)
+		{
+			u32 pairs = runs >> 1;
+			Object** source = state.source;
+
+			// Nhiệm vụ "t" : phần thứ "t % threads" của cặp thứ "t / threads", đoạn lẻ cuối cùng được chép nguyên
+			run_parallel(pairs * threads + (runs & 1u), threads, [&](u32 t)
+				{
+					u32 pair = t / threads;
+					if (pair == pairs)
+					{
+						u32 first = bounds[runs - 1u];
+						std::memcpy(target + first, source + first, sizeof(Object*) * (len - first));
+						return;
+					}
+
+					u32 low = bounds[pair << 1], middle = bounds[(pair << 1) + 1u], high = bounds[(pair << 1) + 2u];
+					Object** a = source + low;
+					Object** b = source + middle;
+					u32 na = middle - low, nb = high - middle;
+
+					u32 part = t % threads;
+					u32 k_first = u32(u64(na + nb) * part / threads);
+					u32 k_last = u32(u64(na + nb) * (part + 1u) / threads);
+
+					u32 i_first = merge_split(a, na, b, nb, k_first);
+					u32 i_last = merge_split(a, na, b, nb, k_last);
+
+					merge_into(a + i_first, i_last - i_first,
+						b + (k_first - i_first), (k_last - i_last) - (k_first - i_first),
+						target + low + k_first);
+				});
+
+			runs = (runs + 1u) >> 1;
+			for (u32 i = 0u; i < runs; ++i)
+				bounds[i] = bounds[i << 1];
+			bounds[runs] = len;
+
+			target = source;
+			state.source = (source == __array) ? state.buffer : __array;
+		}
+	}
+
+#pragma endregion
+
+#pragma region Radix Sort
+
+	template <typename Key>
+	struct __RadixItem
+	{
+		Key key;
+		Object* object;
+	};
+
+	// Khóa không dấu có cùng thứ tự với giá trị.
+
+	static inline u32 radix_key(i32 value)
+	{
+		return u32(value) ^ 0x8000'0000u;
+	}
+
+	static inline u64 radix_key(i64 value)
+	{
+		return u64(value) ^ 0x8000'0000'0000'0000ull;
+	}
+
+	static inline u32 radix_key(f32 value)
+	{
+		// -0.0 bằng 0.0 khi so sánh
+		if (value == 0.0f)
+			value = 0.0f;
+
+		u32 bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return (bits & 0x8000'0000u) ? ~bits : (bits | 0x8000'0000u);
+	}
+
+	static inline u64 radix_key(f64 value)
+	{
+		if (value == 0.0)
+			value = 0.0;
+
+		u64 bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return (bits & 0x8000'0000'0000'0000ull) ? ~bits : (bits | 0x8000'0000'0000'0000ull);
+	}
+
+	template <typename Box>
+	static bool radix_sort_with(Object** __array, u32 len)
+	{
+		using Value = std::remove_const_t<decltype(Box::value)>;
+		using Key = decltype(radix_key(Value()));
+		constexpr const u32 passes = sizeof(Key);
+
+		std::vector<__RadixItem<Key>> items(len), buffer(len);
+		u32 counts[passes][256] = {};
+
+		// Chép khóa và đếm tần suất chữ số của mọi lượt
+		for (u32 i = 0u; i < len; ++i)
+		{
+			Value value = static_cast<Box*>(__array[i])->value;
+
+			// NaN không có thứ tự với "rich_compare" : để cách so sánh xử lý
+			if (value != value)
+				return false;
+
+			Key key = radix_key(value);
+			items[i] = { key, __array[i] };
+
+			for (u32 pass = 0u; pass < passes; ++pass)
+				++counts[pass][(key >> (pass << 3)) & 0xFFu];
+		}
+
+		auto source = items.data();
+		auto target = buffer.data();
+
+		for (u32 pass = 0u; pass < passes; ++pass)
+		{
+			u32* count = counts[pass];
+			u32 shift = pass << 3;
+
+			// Mọi khóa có cùng chữ số : thứ tự không đổi
+			if (count[(source[0].key >> shift) & 0xFFu] == len)
+				continue;
+
+			u32 offset = 0u;
+			for (u32 digit = 0u; digit < 256u; ++digit)
+			{
+				u32 n = count[digit];
+				count[digit] = offset;
+				offset += n;
+			}
+
+			for (u32 i = 0u; i < len; ++i)
+				target[count[(source[i].key >> shift) & 0xFFu]++] = source[i];
+
+			pycpp::swap(source, target);
+		}
+
+		for (u32 i = 0u; i < len; ++i)
+			__array[i] = source[i].object;
+
+		return true;
+	}
+
+	bool radix_sort(Object** __array, u32 len)
+	{
+		if (len == 0u)
+			return false;
+
+		auto kind = __array[0]->type_index();
+		for (u32 i = 1u; i < len; ++i)
+			if (__array[i]->type_index() != kind)
+				return false;
+
+		switch (kind)
+		{
+		case TypeIndex::I32:
+			return radix_sort_with<I32>(__array, len);
+		case TypeIndex::I64:
+			return radix_sort_with<I64>(__array, len);
+		case TypeIndex::F32:
+			return radix_sort_with<F32>(__array, len);
+		case TypeIndex::F64:
+			return radix_sort_with<F64>(__array, len);
+		default:
+			return false;
+		}
+	}
+
+#pragma endregion
+
+#pragma region Sort Engine
+
+	// Chỉ chứa các lớp có sẵn mà "rich_compare" không thay đổi Object.
+	static bool parallel_sort_eligible(Object** __array, u32 len)
+	{
+		for (u32 i = 0u; i < len; ++i)
+			if (is_numeric(__array[i]) == false && __array[i]->type_index() != TypeIndex::Str)
+				return false;
+		return true;
+	}
+
+	void sort_array(Object** __array, u32 len, SortPolicy policy)
+	{
+		if (len >= PYCPP_RADIX_SORT_THRESHOLD && radix_sort(__array, len))
+			return;
+
+		switch (policy)
+		{
+		case SortPolicy::Unstable:
+			pdq_sort(__array, len);
+			break;
+
+		case SortPolicy::Parallel:
+			parallel_sort(__array, len);
+			break;
+
+		default:
+			if (__parallel_sort_threshold != 0u && len >= __parallel_sort_threshold &&
+				parallel_sort_eligible(__array, len))
+				parallel_sort(__array, len);
+			else
+				tim_sort(__array, len);
+			break;
+		}
+	}
+
+#pragma endregion
+
+}
\ No newline at end of file
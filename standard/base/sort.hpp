@@ -0,0 +1,98 @@
+#pragma once
+
+#include "object.hpp"
+
+namespace pycpp
+{
+
+#pragma region Macro
+
+	// Thuật toán mặc định của "sort_array" ( xem SortPolicy ).
+#ifndef PYCPP_SORT_POLICY
+#define PYCPP_SORT_POLICY SortPolicy::Stable
+#endif
+
+	// Số thread mặc định của "parallel_sort", 0 : số nhân của máy.
+#ifndef PYCPP_SORT_THREADS
+#define PYCPP_SORT_THREADS 0u
+#endif
+
+	// SortPolicy::Stable tự động dùng "parallel_sort" với mảng có ít nhất ngần này phần tử
+	// và chỉ chứa Boolean, I32, I64, F32, F64, Str ( 0 : không tự động ).
+#ifndef PYCPP_PARALLEL_SORT_THRESHOLD
+#define PYCPP_PARALLEL_SORT_THRESHOLD (1u << 20)
+#endif
+
+	// Mảng ( ArrayList, Deque ) có ít nhất ngần này phần tử cùng là I32, I64, F32 hoặc F64
+	// được sắp xếp theo cơ số ( xem "radix_sort" ).
+#ifndef PYCPP_RADIX_SORT_THRESHOLD
+#define PYCPP_RADIX_SORT_THRESHOLD 64u
+#endif
+
+#pragma endregion
+
+#pragma region Declaration : Sort Engine
+
+	/*
+	Sort Engine : sắp xếp tăng dần mảng Object theo "rich_compare" ( chỉ dùng phép so sánh "a < b" ).
+
+	- Không thay đổi tham chiếu của phần tử, chỉ hoán vị các con trỏ.
+	- Nếu "rich_compare" ném lỗi, mảng vẫn chứa đúng các phần tử ban đầu ( thứ tự không xác định ).
+	*/
+	enum class SortPolicy : uint8_t
+	{
+		// Timsort : ổn định ( giữ thứ tự các phần tử bằng nhau ), gần tuyến tính với dữ liệu gần như đã sắp xếp.
+		Stable = 0,
+
+		// Pattern-defeating quicksort : không ổn định, không cần bộ nhớ phụ, O(n log n) trong trường hợp xấu nhất.
+		Unstable,
+
+		// Merge sort nhiều thread : cùng kết quả với Stable, xem "parallel_sort".
+		Parallel
+	};
+
+	// Timsort : tìm các đoạn đã sắp xếp ( đảo ngược đoạn giảm dần ), gộp với chế độ "galloping".
+	// Cần bộ nhớ phụ tối đa len / 2 con trỏ.
+	void tim_sort(Object** __array, u32 len);
+
+	// Pattern-defeating quicksort : trung vị của 3 ( hoặc 9 ) làm chốt, phát hiện đoạn đã sắp xếp
+	// và nhiều phần tử bằng nhau, chuyển sang heapsort khi phân hoạch lệch quá nhiều lần.
+	void pdq_sort(Object** __array, u32 len);
+
+	/*
+	Parallel Sort : merge sort ổn định trên nhiều thread, kết quả giống hệt "tim_sort".
+
+	- Mỗi thread sắp xếp một đoạn bằng "tim_sort", sau đó gộp từng cặp đoạn liền kề. Mỗi lần gộp được chia
+	  cho mọi thread theo vị trí trong kết quả ( tìm điểm cắt bằng tìm kiếm nhị phân ) nên không có thread rảnh.
+	- Chỉ di chuyển con trỏ, không thay đổi tham chiếu. Cần bộ nhớ phụ "len" con trỏ.
+	- Mỗi thread có ít nhất 16384 phần tử, mảng nhỏ hơn được sắp xếp trên thread gọi.
+	- "rich_compare" được gọi đồng thời từ nhiều thread : chỉ an toàn khi nó không thay đổi Object
+	  ( đúng với các lớp có sẵn ). Lỗi đầu tiên được ném lại trên thread gọi.
+	*/
+
+	// "threads" bằng 0 : dùng giá trị của "sort_set_threads".
+	void parallel_sort(Object** __array, u32 len, u32 threads = 0u);
+
+	// Số thread mặc định của "parallel_sort" ( 0 : số nhân của máy ).
+	void sort_set_threads(u32 threads);
+
+	// Ngưỡng tự động dùng "parallel_sort" của SortPolicy::Stable ( 0 : không tự động ).
+	void sort_set_parallel_threshold(u32 threshold);
+
+	/*
+	Radix Sort : sắp xếp theo cơ số ( LSD, 8 bit mỗi lượt ) khi mọi phần tử cùng là I32, I64, F32 hoặc F64.
+
+	- Một lượt kiểm tra kiểu, một lượt chép ( khóa, con trỏ ) vào mảng liên tiếp và đếm tần suất của mọi chữ số,
+	  bỏ qua các lượt mà mọi khóa có cùng chữ số, rồi ghi lại các con trỏ theo thứ tự.
+	- Khóa của số thực : lật bit dấu ( số dương ) hoặc mọi bit ( số âm ), -0.0 được xem như 0.0.
+	- Ổn định : kết quả giống hệt "tim_sort", không gọi "rich_compare".
+	- Trả về false ( không thay đổi mảng ) nếu các phần tử khác kiểu, là lớp khác hoặc có NaN.
+	*/
+	bool radix_sort(Object** __array, u32 len);
+
+	// Sắp xếp theo "policy", dùng "radix_sort" khi có thể ( với mọi "policy" ).
+	void sort_array(Object** __array, u32 len, SortPolicy policy = PYCPP_SORT_POLICY);
+
+#pragma endregion
+
+}
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include "str.hpp"
 #include "pair.hpp"
 #include "var.hpp"
+#include "algo.hpp"
+#include "error.hpp"
+#include "intern.hpp"
+
+#include <cstring>
 
 // #define _CRT_SECURE_NO_WARNINGS
 #pragma warning(disable : 4996)
@@ -12,23 +17,64 @@ namespace pycpp
 
 	#pragma region Constructors & Destructors
 
-	Str::Str() : string() {}
+	Str::Str() : string(), hash_value(HASH_NOT_COMPUTED) {}
 
-	Str::Str(Str& source) : string(source.string) {}
+	Str::Str(Str& source) : string(source.string), hash_value(source.hash_value) {}
 
-	Str::Str(Object* source)
+	Str::Str(Object* source) : hash_value(HASH_NOT_COMPUTED)
 	{
 		source->output(string);
 		SAFE(source);
 	}
 
-	Str::Str(const char* content) : string(content) {}
+	Str::Str(const char* content) : string(content), hash_value(HASH_NOT_COMPUTED) {}
+
+	Str::~Str()
+	{
+		if (is_interned())
+			intern_discard(this);
+	}
 
 	#pragma endregion
 
 	#pragma region Standard Methods
 
+	void Str::assign(const char* content)
+	{
+		if (is_frozen())
+			__pycpp_error_modify_frozen_object("Str::assign", "Str");
+		if (is_interned())
+			__pycpp_error_modify_interned_object("Str::assign", "Str");
+
+		string = content;
+		hash_value = HASH_NOT_COMPUTED;
+	}
 
+	void Str::append(const char* content)
+	{
+		if (is_frozen())
+			__pycpp_error_modify_frozen_object("Str::append", "Str");
+		if (is_interned())
+			__pycpp_error_modify_interned_object("Str::append", "Str");
+
+		string += content;
+		hash_value = HASH_NOT_COMPUTED;
+	}
+
+	void Str::append(Str* other)
+	{
+		if (is_frozen() || is_interned())
+		{
+			SAFE(other);
+			if (is_frozen())
+				__pycpp_error_modify_frozen_object("Str::append", "Str");
+			__pycpp_error_modify_interned_object("Str::append", "Str");
+		}
+
+		string += other->string;
+		hash_value = HASH_NOT_COMPUTED;
+		SAFE(other);
+	}
 
 	#pragma endregion
 
@@ -67,10 +113,12 @@ namespace pycpp
 
 	u64 Str::hash()
 	{
-		u64 hash_value = 0;
-		for (char ch : string)
-			hash_value = (hash_value * 31) + ch;
+		if (hash_value != HASH_NOT_COMPUTED)
+			return hash_value;
 
+		// 0 được dùng làm đánh dấu "chưa tính"
+		auto result = hash_bytes(string.data(), string.size());
+		hash_value = result != HASH_NOT_COMPUTED ? result : 1u;
 		return hash_value;
 	}
 
@@ -94,11 +142,18 @@ namespace pycpp
 		switch (other->type())
 		{
 		case Str::type_id:
-			result = dynamic_cast<Str*>(other)->string.compare(string) == 0;
+		{
+			// Độ dài, hash đã lưu, sau đó mới so sánh nội dung
+			auto other_str = static_cast<Str*>(other);
+			result = string.size() == other_str->string.size() &&
+				(hash_value == HASH_NOT_COMPUTED || other_str->hash_value == HASH_NOT_COMPUTED ||
+					hash_value == other_str->hash_value) &&
+				std::memcmp(string.data(), other_str->string.data(), string.size()) == 0;
 			break;
+		}
 
 		case Pair::type_id:
-			result = equal(dynamic_cast<Pair*>(other)->key());
+			result = equal(static_cast<Pair*>(other)->key());
 			break;
 		}
 
@@ -115,11 +170,11 @@ namespace pycpp
 		switch (other->type())
 		{
 		case Str::type_id:
-			result = string.compare(dynamic_cast<Str*>(other)->string);
+			result = string.compare(static_cast<Str*>(other)->string);
 			break;
 
 		case Pair::type_id:
-			result = rich_compare(dynamic_cast<Pair*>(other)->key());
+			result = rich_compare(static_cast<Pair*>(other)->key());
 
 		default:
 		{
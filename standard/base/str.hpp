@@ -1,18 +1,34 @@
+#pragma once
+
 #include "object.hpp"
+#include "allocator.hpp"
 
 namespace pycpp
 {
 
 #pragma region Declaration : Str
 
+	/*
+	Str : chuỗi ký tự, nội dung chỉ thay đổi qua "assign" / "append".
+
+	- "hash" được tính một lần ( đọc 8 byte mỗi lần, xem "hash_bytes" ) và lưu lại cho tới khi nội dung thay đổi.
+	- "equal" so sánh độ dài và hash đã lưu ( nếu cả hai đã tính ) trước khi so sánh nội dung.
+	- Str đã intern ( xem "intern" ) không thể thay đổi, hai Str đã intern bằng nhau khi cùng địa chỉ.
+	*/
 	class Str final : public Object
 	{
 
 	#pragma region Str
 		std::string string;
 
+		// Hash đã tính của "string", HASH_NOT_COMPUTED nếu chưa tính.
+		u64 hash_value;
+
+		static constexpr const u64 HASH_NOT_COMPUTED = 0u;
+
 	public:
-		TYPE_ID(Str);
+		BUILTIN_TYPE_ID(Str);
+		SLAB_ALLOCATOR(Str);
 
 		#pragma region Constructors & Destructors
 
@@ -21,13 +37,23 @@ namespace pycpp
 		Str(Object* source);
 		Str(const char* content);
 
-		~Str() = default;
+		~Str();
 
 		#pragma endregion
 
 		#pragma region Standard Methods
 
+		inline const char* c_str() const { return string.c_str(); }
+		inline u32 size() const { return u32(string.size()); }
+
+		// Thay nội dung, hash được tính lại ở lần gọi "hash" tiếp theo.
+		// (!) : hàm ném lỗi runtime nếu Str đã bị freeze hoặc đã intern.
+		void assign(const char* content);
 
+		// Nối thêm vào cuối nội dung.
+		// (!) : hàm ném lỗi runtime nếu Str đã bị freeze hoặc đã intern.
+		void append(const char* content);
+		void append(Str* other);
 
 		#pragma endregion
 
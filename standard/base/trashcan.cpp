@@ -0,0 +1,195 @@
+#include "trashcan.hpp"
+#include "allocator.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pycpp
+{
+
+#pragma region Definition : Trashcan
+
+	struct __TrashState
+	{
+		// Độ sâu hiện tại của chuỗi hàm hủy.
+		u32 depth = 0u;
+
+		// Số Object đã giải phóng trong lần gọi ngoài cùng hiện tại.
+		u32 work = 0u;
+
+		std::vector<Object*> pending;
+
+		~__TrashState()
+		{
+			// Thread kết thúc : giải phóng toàn bộ, không giới hạn
+			depth = 1u;
+			while (!pending.empty())
+			{
+				auto object = pending.back();
+				pending.pop_back();
+				delete object;
+			}
+		}
+	};
+
+	static thread_local __TrashState trash_state;
+
+	static inline bool trash_exhausted(const __TrashState& state)
+	{
+		// PYCPP_TRASHCAN_BUDGET bằng 0 : không giới hạn
+#if PYCPP_TRASHCAN_BUDGET != 0
+		return state.work >= PYCPP_TRASHCAN_BUDGET;
+#else
+		(void)state;
+		return false;
+#endif
+	}
+
+	// Giải phóng hàng đợi ở độ sâu 0, tối đa "limit" Object.
+	static void trash_drain(__TrashState& state, u32 limit)
+	{
+		u32 released = 0u;
+		while (!state.pending.empty() && released < limit && !trash_exhausted(state))
+		{
+			auto object = state.pending.back();
+			state.pending.pop_back();
+
+			++state.depth;
+			++state.work;
+			delete object;
+			--state.depth;
+
+			++released;
+		}
+	}
+
+	void destroy(const Object* object)
+	{
+		auto& state = trash_state;
+		auto target = const_cast<Object*>(object);
+
+		if (state.depth >= PYCPP_TRASHCAN_DEPTH || trash_exhausted(state))
+		{
+			state.pending.push_back(target);
+			return;
+		}
+
+		++state.depth;
+		++state.work;
+		delete target;
+		--state.depth;
+
+		// Lần gọi ngoài cùng : giải phóng các Object bị hoãn do vượt độ sâu
+		if (state.depth == 0u)
+		{
+			trash_drain(state, UINT32_MAX);
+			state.work = 0u;
+		}
+	}
+
+	u32 empty_trash(u32 limit)
+	{
+		auto& state = trash_state;
+
+		// Đang ở trong hàm hủy : để lần gọi ngoài cùng xử lý
+		if (state.depth != 0u)
+			return u32(state.pending.size());
+
+		trash_drain(state, limit);
+		state.work = 0u;
+		return u32(state.pending.size());
+	}
+
+#pragma endregion
+
+#pragma region Definition : Background Reclamation
+
+	struct __Reclaimer
+	{
+		std::mutex lock;
+		std::condition_variable signal;
+		std::vector<Object*> queue;
+		std::thread worker;
+		bool running = false;
+	};
+
+	static __Reclaimer& reclaimer()
+	{
+		// Không bao giờ hủy : thread nền có thể còn chạy khi chương trình kết thúc.
+		static __Reclaimer* instance = new __Reclaimer();
+		return *instance;
+	}
+
+	static void reclaimer_loop()
+	{
+		auto& state = reclaimer();
+		std::vector<Object*> batch;
+
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> guard(state.lock);
+				state.signal.wait(guard, [&state] { return !state.queue.empty() || !state.running; });
+
+				if (state.queue.empty() && !state.running)
+					return;
+				batch.swap(state.queue);
+			}
+
+			for (auto object : batch)
+				destroy(object);
+			batch.clear();
+
+			while (empty_trash() != 0u) {}
+
+			// Thread nền chỉ giải phóng : trả bộ nhớ về kho chung cho các thread cấp phát
+			slab_flush_thread_cache();
+		}
+	}
+
+	void start_background_reclamation()
+	{
+		auto& state = reclaimer();
+		std::lock_guard<std::mutex> guard(state.lock);
+		if (state.running)
+			return;
+
+		state.running = true;
+		state.worker = std::thread(reclaimer_loop);
+	}
+
+	void stop_background_reclamation()
+	{
+		auto& state = reclaimer();
+		{
+			std::lock_guard<std::mutex> guard(state.lock);
+			if (!state.running)
+				return;
+			state.running = false;
+		}
+
+		state.signal.notify_one();
+		state.worker.join();
+	}
+
+	void __reclaim_in_background(Object* object)
+	{
+		auto& state = reclaimer();
+		{
+			std::lock_guard<std::mutex> guard(state.lock);
+			if (state.running)
+			{
+				state.queue.push_back(object);
+				state.signal.notify_one();
+				return;
+			}
+		}
+
+		destroy(object);
+	}
+
+#pragma endregion
+
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "object.hpp"
+
+#include <cstdint>
+
+namespace pycpp
+{
+
+#pragma region Macro
+
+	// Độ sâu tối đa của các hàm hủy lồng nhau ( container chứa container ... ).
+	// Vượt quá độ sâu này, Object được hoãn giải phóng thay vì đệ quy tiếp.
+#ifndef PYCPP_TRASHCAN_DEPTH
+#define PYCPP_TRASHCAN_DEPTH 64u
+#endif
+
+	// Số Object tối đa được giải phóng trong một lần gọi "destroy" ngoài cùng, 0 : không giới hạn.
+	// Phần còn lại được giải phóng ở các lần gọi sau hoặc bởi "empty_trash".
+#ifndef PYCPP_TRASHCAN_BUDGET
+#define PYCPP_TRASHCAN_BUDGET 0u
+#endif
+
+#pragma endregion
+
+#pragma region Declaration : Trashcan
+
+	/*
+	Trashcan : giải phóng Object với độ sâu đệ quy và khối lượng công việc có giới hạn.
+
+	- Mỗi thread có một hàng đợi Object bị hoãn ( thread_local ), không cần khóa.
+	- Object bị hoãn khi chuỗi hàm hủy vượt PYCPP_TRASHCAN_DEPTH hoặc lần gọi hiện tại đã hết PYCPP_TRASHCAN_BUDGET.
+	- Lần gọi "destroy" ngoài cùng giải phóng dần hàng đợi bằng vòng lặp, không đệ quy.
+	- Thread nền ( tùy chọn ) : "DECREF_BACKGROUND" chuyển Object vừa mất tham chiếu cuối cùng cho thread nền.
+	*/
+
+	// Giải phóng Object ( thay cho "delete" ), được gọi bởi SAFE / DECREF / DEREFERENCE.
+	void destroy(const Object* object);
+
+	// Giải phóng tối đa "limit" Object đang bị hoãn của thread hiện tại.
+	// Trả về số Object còn lại trong hàng đợi.
+	u32 empty_trash(u32 limit = UINT32_MAX);
+
+	// Khởi động thread giải phóng nền, không làm gì nếu đã khởi động.
+	void start_background_reclamation();
+
+	// Giải phóng toàn bộ Object đang chờ rồi dừng thread nền.
+	void stop_background_reclamation();
+
+	// Chuyển Object cho thread nền, giải phóng ngay nếu thread nền chưa khởi động.
+	void __reclaim_in_background(Object* object);
+
+	// Giảm tham chiếu, nếu là tham chiếu cuối cùng thì Object được giải phóng ở thread nền.
+	// Dùng khi bỏ một đồ thị Object lớn trên luồng xử lý yêu cầu.
+	// (!) : các Object trong đồ thị không được dùng chung với thread khác khi PYCPP_REFCOUNT_MODE là PLAIN.
+	// Không kiểm tra nullptr.
+	inline void DECREF_BACKGROUND(const Object* object)
+	{
+		if (object->ref_count.decrease(object))
+			__reclaim_in_background(const_cast<Object*>(object));
+	}
+
+#pragma endregion
+
+}
\ No newline at end of file
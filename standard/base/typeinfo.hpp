@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+
+namespace pycpp
+{
+
+#pragma region Declaration : Type Index
+
+	/*
+	Type Index : định danh dày đặc ( 1, 2, 3, ... ) cho các lớp có sẵn của thư viện.
+
+	- "type_id" của các lớp có sẵn chính là giá trị TypeIndex tương ứng, "switch" trên "type()"
+	  được biên dịch thành bảng nhảy ( jump table ).
+	- Lớp do người dùng định nghĩa ( TYPE_ID ) có "type_id" nằm ngoài khoảng này và nhận TypeIndex::Unknown.
+	- Object lưu TypeIndex và các bit Capability trong header ( không cần gọi hàm ảo sau lần đầu ).
+	*/
+
+	enum class TypeIndex : uint16_t
+	{
+		// Chưa xác định, Object sẽ gọi "type()" ở lần truy vấn đầu tiên.
+		Unresolved = 0,
+
+		// Lớp không có trong bảng đăng ký ( lớp của người dùng ).
+		Unknown,
+
+		// Base
+		Boolean,
+		None,
+		I32,
+		I64,
+		F32,
+		F64,
+		Str,
+		Pair,
+
+		// Iterable & Iterator
+		Range,
+		RangeIterator,
+		ArrayIterator,
+		HashTableIterator,
+		DequeIterator,
+		OrderedMapIterator,
+		FixedArrayIterator,
+		TypedArrayIterator,
+		ViewIterator,
+
+		// Collections
+		ArrayList,
+		Tuple,
+		Deque,
+		HashTable,
+		OrderedMap,
+		FixedArray,
+		I32Array,
+		I64Array,
+		F32Array,
+		F64Array,
+		View,
+
+		Count
+	};
+
+	// Mọi "type_id" sinh bởi TYPE_ID đều >= 64 ( ký tự đầu tiên của tên lớp ), không trùng với TypeIndex.
+	static_assert(uint16_t(TypeIndex::Count) <= 64u, "TypeIndex must not overlap user type ids");
+
+	// Các interface / lớp trừu tượng mà lớp có sẵn triển khai.
+	enum TypeCapability : uint8_t
+	{
+		CAPABILITY_ITERABLE = 1u << 0,
+		CAPABILITY_ITERATOR = 1u << 1,
+		CAPABILITY_ARGUMENTS = 1u << 2,
+		CAPABILITY_CONTAINER = 1u << 3,
+		CAPABILITY_LIST = 1u << 4,
+		CAPABILITY_SET = 1u << 5,
+		CAPABILITY_ARRAY = 1u << 6,		// __Array
+		CAPABILITY_HASHTABLE = 1u << 7	// __HashTable
+	};
+
+	// Chuyển "type_id" sang TypeIndex.
+	constexpr inline TypeIndex type_index_of(int64_t type_id)
+	{
+		return (type_id > int64_t(TypeIndex::Unknown) && type_id < int64_t(TypeIndex::Count)) ?
+			TypeIndex(type_id) : TypeIndex::Unknown;
+	}
+
+	// Bảng Capability của các lớp có sẵn.
+	constexpr inline uint8_t type_capabilities(TypeIndex index)
+	{
+		switch (index)
+		{
+		case TypeIndex::Range:
+			return CAPABILITY_ITERABLE;
+
+		case TypeIndex::RangeIterator:
+		case TypeIndex::ArrayIterator:
+		case TypeIndex::HashTableIterator:
+		case TypeIndex::DequeIterator:
+		case TypeIndex::OrderedMapIterator:
+		case TypeIndex::FixedArrayIterator:
+		case TypeIndex::TypedArrayIterator:
+		case TypeIndex::ViewIterator:
+			return CAPABILITY_ITERATOR;
+
+		case TypeIndex::ArrayList:
+			return CAPABILITY_ITERABLE | CAPABILITY_CONTAINER | CAPABILITY_LIST | CAPABILITY_ARGUMENTS | CAPABILITY_ARRAY;
+
+		case TypeIndex::Tuple:
+			return CAPABILITY_ITERABLE | CAPABILITY_ARGUMENTS | CAPABILITY_ARRAY;
+
+		case TypeIndex::View:
+			return CAPABILITY_ITERABLE | CAPABILITY_ARGUMENTS;
+
+		case TypeIndex::Deque:
+		case TypeIndex::FixedArray:
+		case TypeIndex::I32Array:
+		case TypeIndex::I64Array:
+		case TypeIndex::F32Array:
+		case TypeIndex::F64Array:
+			return CAPABILITY_ITERABLE | CAPABILITY_CONTAINER | CAPABILITY_LIST | CAPABILITY_ARGUMENTS;
+
+		case TypeIndex::HashTable:
+			return CAPABILITY_ITERABLE | CAPABILITY_CONTAINER | CAPABILITY_SET | CAPABILITY_HASHTABLE;
+
+		case TypeIndex::OrderedMap:
+			return CAPABILITY_ITERABLE | CAPABILITY_CONTAINER | CAPABILITY_SET | CAPABILITY_ARGUMENTS;
+
+		default:
+			return 0u;
+		}
+	}
+
+#pragma endregion
+
+}
@@ -2,8 +2,13 @@
 
 #include "error.hpp"
 #include "object.hpp"
+#include "primitive.hpp"
+#include "trashcan.hpp"
 
+#include <cstring>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace pycpp
 {
@@ -15,25 +20,26 @@ namespace pycpp
 #define ENABLE_IF(expression) typename std::enable_if_t<expression, bool> = true
 
 
+	// Giải phóng Object nếu nó không có tham chiếu ( Object tạm ).
 	inline void SAFE(const Object* object)
 	{
-		if (object->ref_count == 0u)
-			delete object;
+		if (object->ref_count.is_zero())
+			destroy(object);
 	}
 
 	template <typename T, ENABLE_IF(!BASE_OF(Object, T))>
 	inline void SAFE(const T* interface__)
 	{
 		// Note : mọi class cần phải kế thừa Object
-		auto object = dynamic_cast<const Object*>(interface__);
-		if (object->ref_count == 0u)
-			delete object;
+		auto object = AS_OBJECT(interface__);
+		if (object->ref_count.is_zero())
+			destroy(object);
 	}
 
 	// Không kiểm tra nullptr.
 	inline void INREF(const Object* object)
 	{
-		++object->ref_count;
+		object->ref_count.increase();
 	}
 
 	// Không kiểm tra nullptr.
@@ -41,14 +47,15 @@ namespace pycpp
 	inline void INREF(const T* object)
 	{
 		// Note : mọi class cần phải kế thừa Object
-		++ dynamic_cast<const Object*>(object)->ref_count;
+		AS_OBJECT(object)->ref_count.increase();
 	}
 
 
+	// Giảm tham chiếu nhưng không giải phóng, Object có thể được SAFE sau đó.
 	// Không kiểm tra nullptr.
 	inline void DEREF(const Object* object)
 	{
-		--object->ref_count;
+		object->ref_count.decrease(object);
 	}
 
 	// Không kiểm tra nullptr.
@@ -56,10 +63,74 @@ namespace pycpp
 	inline void DEREF(const T* object)
 	{
 		// Note : mọi class cần phải kế thừa Object
-		-- dynamic_cast<const Object*>(object)->ref_count;
+		auto __object = AS_OBJECT(object);
+		__object->ref_count.decrease(__object);
 	}
 
 
+	// Giảm tham chiếu và giải phóng Object nếu đó là tham chiếu cuối cùng ( DEREF + SAFE ).
+	// Với PYCPP_REFCOUNT_ATOMIC / BIASED, chỉ một thread giải phóng Object, khác với DEREF + SAFE.
+	// Không kiểm tra nullptr.
+	inline void DECREF(const Object* object)
+	{
+		if (object->ref_count.decrease(object))
+			destroy(object);
+	}
+
+	// Không kiểm tra nullptr.
+	template <typename T, ENABLE_IF(!BASE_OF(Object, T))>
+	inline void DECREF(const T* object)
+	{
+		// Note : mọi class cần phải kế thừa Object
+		auto __object = AS_OBJECT(object);
+		if (__object->ref_count.decrease(__object))
+			destroy(__object);
+	}
+
+
+	// Tham số đánh dấu : hàm nhận luôn tham chiếu của người gọi ( "steal" ), không INREF.
+	// Người gọi không được DEREF Object sau khi truyền vào.
+	struct __StealReference {};
+	constexpr const __StealReference STEAL_REFERENCE{};
+
+
+	// Ép kiểu Object* sang T* ( xuống lớp con hoặc interface ), trả về nullptr nếu không hợp lệ.
+	// Mặc định sử dụng dynamic_cast, các interface có sẵn được đặc tả lại trong "collections/iterable.hpp".
+	template <typename T, typename = void>
+	struct __ObjectCast
+	{
+		static inline T* cast(Object* object)
+		{
+			return dynamic_cast<T*>(object);
+		}
+	};
+
+	// Lớp "final" có "type_id" : so sánh định danh thay cho dynamic_cast.
+	template <typename T>
+	struct __ObjectCast<T, std::enable_if_t<
+		std::is_final_v<T> && BASE_OF(Object, T),
+		std::void_t<decltype(T::type_id)>>>
+	{
+		static inline T* cast(Object* object)
+		{
+			if constexpr (type_index_of(T::type_id) != TypeIndex::Unknown)
+			{
+				if (object->type_index() == type_index_of(T::type_id))
+					return static_cast<T*>(object);
+			}
+			else if (object->type() == T::type_id)
+				return static_cast<T*>(object);
+
+			return nullptr;
+		}
+	};
+
+	template <typename T>
+	inline T* OBJECT_CAST(Object* object)
+	{
+		return __ObjectCast<T>::cast(object);
+	}
+
 	// T* REFERENCE<T, U>(U*) with 7 case : with U is not T.
 	// Acronyms :
 	//		`<-` : is base of.
@@ -126,7 +197,7 @@ namespace pycpp
 
 		if (object != nullptr)	// (1)
 		{
-			auto result = dynamic_cast<T*>(object);	// (1.1)
+			auto result = OBJECT_CAST<T>(object);	// (1.1)
 
 			if (result != nullptr)	// (1.2)
 				INREF(object);
@@ -168,7 +239,7 @@ namespace pycpp
 
 		if (interface__ != nullptr)	// (1.)
 		{
-			auto result = dynamic_cast<T*>(interface__);	// (1.1)
+			auto result = OBJECT_CAST<T>(AS_OBJECT(interface__));	// (1.1)
 
 			if (result != nullptr)	// (1.2)
 				INREF(result);	// (1.2.1)
@@ -243,10 +314,10 @@ namespace pycpp
 		if (interface__ != nullptr)	// (1)
 		{
 			// Note : mọi class buộc phải kế thừa Object
-			auto object = dynamic_cast<Object*>(interface__);	// (1.1)
+			auto object = AS_OBJECT(interface__);	// (1.1)
 			INREF(object);	// (1.2)
 
-			auto result = dynamic_cast<T*>(interface__);	// (1.3)
+			auto result = OBJECT_CAST<T>(object);	// (1.3)
 			if (result == nullptr)	// (1.4)
 			{
 				SAFE(object);	// (1.4.1)
@@ -266,8 +337,7 @@ namespace pycpp
 		if (reference == nullptr)
 			return;
 
-		DEREF(reference);
-		SAFE(reference);
+		DECREF(reference);
 		reference = nullptr;
 	}
 
@@ -278,10 +348,9 @@ namespace pycpp
 			return;
 
 		// Note : mọi class buộc phải kế thừa Object
-		auto object = dynamic_cast<Object*>(reference);
+		auto object = AS_OBJECT(reference);
 		reference = nullptr;
-		DEREF(object);
-		SAFE(object);
+		DECREF(object);
 	}
 
 #pragma endregion
@@ -315,6 +384,12 @@ namespace pycpp
 			INREF(ref);
 		}
 
+		// Nhận tham chiếu của "source", "source" trở thành rỗng.
+		inline Var(Var&& source) noexcept : ref(source.ref)
+		{
+			source.ref = nullptr;
+		}
+
 #pragma region Var<T>(U*)
 
 		// Case [1, 3]
@@ -334,7 +409,7 @@ namespace pycpp
 			if (object == nullptr)
 				return;
 
-			ref = dynamic_cast<T*>(object);
+			ref = OBJECT_CAST<T>(object);
 
 			// Lost reference to object
 			if (ref == nullptr)
@@ -353,7 +428,7 @@ namespace pycpp
 			if (object == nullptr)
 				return;
 
-			ref = dynamic_cast<T*>(object);
+			ref = OBJECT_CAST<T>(AS_OBJECT(object));
 
 			// Lost reference to object
 			if (ref != nullptr)
@@ -384,7 +459,7 @@ namespace pycpp
 			if (object == nullptr)
 				return;
 
-			ref = dynamic_cast<T*>(object);
+			ref = OBJECT_CAST<T>(AS_OBJECT(object));
 
 			// Lost reference to object
 			if (ref == nullptr)
@@ -415,6 +490,15 @@ namespace pycpp
 
 	public:
 
+		// Trả về Object và chuyển tham chiếu của Var cho người gọi, Var trở thành rỗng.
+		// Dùng với các hàm "steal" : list->push_steal(var.release()).
+		inline T* release()
+		{
+			auto result = ref;
+			ref = nullptr;
+			return result;
+		}
+
 		template <class U, ENABLE_IF(!SAME(U, T) && BASE_OF(U, T))>
 		inline U* bind()
 		{
@@ -426,7 +510,10 @@ namespace pycpp
 		template <class U, ENABLE_IF(!SAME(U, T) && !BASE_OF(U, T))>
 		inline U* bind()
 		{
-			U* binding = dynamic_cast<U*>(ref);
+			if (ref == nullptr)
+				return nullptr;
+
+			U* binding = OBJECT_CAST<U>(AS_OBJECT(ref));
 			return binding;
 		}
 
@@ -472,6 +559,19 @@ namespace pycpp
 			return *this;
 		}
 
+		inline Var& operator=(Var&& source) noexcept
+		{
+			if (this == std::addressof(source))
+				return *this;
+
+			auto n_ref = source.ref;
+			source.ref = nullptr;
+			safe();
+
+			ref = n_ref;
+			return *this;
+		}
+
 		template <class U, ENABLE_IF(!SAME(T, U))>
 		inline Var& operator=(U* object)
 		{
@@ -505,4 +605,415 @@ namespace pycpp
 
 #pragma endregion
 
+#pragma region Var<Object> Definition
+
+	/*
+	Var<Object> : lưu trực tiếp ( immediate ) các giá trị số trong một word 64 bit gắn thẻ,
+	không cấp phát Object trên heap.
+
+	Bố cục của "bits" ( 3 bit thấp là thẻ, Object luôn được căn chỉnh tối thiểu 8 bytes ) :
+	- ...000 : con trỏ Object* hoặc nullptr.
+	- ...001 : I32, giá trị nằm ở 32 bit cao.
+	- ...010 : F32, bit pattern nằm ở 32 bit cao.
+	- ...011 : I64 có giá trị vừa 61 bit, lưu "value << 3".
+	- ...100 : F64 có |value| trong [2^-127, 2^128) hoặc bằng ±0.0 : bit dấu ở bit 63, mũ thu gọn 8 bit
+	  ( mũ - 895, 0 dành cho ±0.0 ) ở bit 55 - 62, 52 bit phần định trị đầy đủ ở bit 3 - 54.
+	I64 / F64 không thỏa điều kiện ( số rất lớn / rất nhỏ, inf, NaN ) được lưu bằng Object trên heap.
+	Boolean và None là Object tĩnh, luôn lưu con trỏ.
+
+	Object thật chỉ được tạo ( materialize ) khi cần con trỏ : operator->, operator&, bind.
+	Sau đó Var giữ con trỏ này thay cho giá trị immediate.
+	*/
+
+	template <>
+	class Var<Object> final
+	{
+		u64 bits;
+
+		static constexpr const u64 TAG_MASK = 0b111u;
+		static constexpr const u64 TAG_POINTER = 0b000u;
+		static constexpr const u64 TAG_I32 = 0b001u;
+		static constexpr const u64 TAG_F32 = 0b010u;
+		static constexpr const u64 TAG_I64 = 0b011u;
+		static constexpr const u64 TAG_F64 = 0b100u;
+
+		static constexpr const i64 IMMEDIATE_I64_MIN = -(i64(1) << 60);
+		static constexpr const i64 IMMEDIATE_I64_MAX = (i64(1) << 60) - 1;
+
+		static constexpr const u64 F64_SIGN = 1ull << 63;
+		static constexpr const u64 F64_MANTISSA = (1ull << 52) - 1u;
+
+		// Mũ ( đã cộng 1023 ) lưu trực tiếp được : 2^-127 <= |value| < 2^128.
+		static constexpr const u64 IMMEDIATE_F64_EXPONENT_MIN = 896u;
+		static constexpr const u64 IMMEDIATE_F64_EXPONENT_MAX = 1150u;
+		static constexpr const u64 IMMEDIATE_F64_EXPONENT_OFFSET = IMMEDIATE_F64_EXPONENT_MIN - 1u;
+
+	public:
+
+#pragma region Constructors & Destructors
+
+		inline Var() : bits(0u) {}
+
+		~Var()
+		{
+			safe();
+		}
+
+		inline Var(Object* object) : bits(encode_pointer(object)) {}
+
+		inline Var(Var& source) : bits(source.bits)
+		{
+			if (is_pointer())
+				INREF(pointer());
+		}
+
+		// Nhận giá trị của "source", "source" trở thành rỗng.
+		inline Var(Var&& source) noexcept : bits(source.bits)
+		{
+			source.bits = 0u;
+		}
+
+		// U kế thừa Object hoặc là interface.
+		template <class U, ENABLE_IF(!SAME(Object, U))>
+		inline Var(U* object) : bits(0u)
+		{
+			if (object == nullptr)
+				return;
+
+			bits = encode_pointer(AS_OBJECT(object));
+		}
+
+		template <class U, ENABLE_IF(!SAME(Object, U))>
+		inline Var(Var<U>& source) : Var(&source) {}
+
+#pragma region Var<Object>(value)
+
+		inline Var(bool value) : bits(encode_pointer(value ? TRUE : FALSE)) {}
+
+		inline Var(i32 value) : bits((u64(u32(value)) << 32) | TAG_I32) {}
+
+		inline Var(f32 value) : bits(0u)
+		{
+			u32 pattern;
+			std::memcpy(&pattern, &value, sizeof(pattern));
+			bits = (u64(pattern) << 32) | TAG_F32;
+		}
+
+		inline Var(i64 value) : bits(0u)
+		{
+			if (value >= IMMEDIATE_I64_MIN && value <= IMMEDIATE_I64_MAX)
+				bits = (u64(value) << 3) | TAG_I64;
+			else
+				bits = encode_pointer(I64::from(value));
+		}
+
+		inline Var(f64 value) : bits(0u)
+		{
+			u64 pattern;
+			std::memcpy(&pattern, &value, sizeof(pattern));
+
+			u64 exponent = (pattern >> 52) & 0x7FFu;
+			u64 sign_mantissa = (pattern & F64_SIGN) | ((pattern & F64_MANTISSA) << 3) | TAG_F64;
+
+			if (exponent >= IMMEDIATE_F64_EXPONENT_MIN && exponent <= IMMEDIATE_F64_EXPONENT_MAX)
+				bits = sign_mantissa | ((exponent - IMMEDIATE_F64_EXPONENT_OFFSET) << 55);
+			else if ((pattern & ~F64_SIGN) == 0u)
+				bits = sign_mantissa;
+			else
+				bits = encode_pointer(F64::from(value));
+		}
+
+#pragma endregion
+
+#pragma endregion
+
+#pragma region Methods Definition
+
+	private:
+
+		static inline u64 encode_pointer(Object* object)
+		{
+			if (object != nullptr)
+				INREF(object);
+			return reinterpret_cast<u64>(object);
+		}
+
+		inline bool is_pointer() const
+		{
+			return bits != 0u && (bits & TAG_MASK) == TAG_POINTER;
+		}
+
+		inline Object* pointer() const
+		{
+			return reinterpret_cast<Object*>(bits);
+		}
+
+		inline void safe()
+		{
+			if (is_pointer())
+			{
+				auto object = pointer();
+				DECREF(object);
+			}
+			bits = 0u;
+		}
+
+		// Nhận giá trị của "temporary", giá trị cũ được giải phóng khi "temporary" bị hủy.
+		inline Var& assign(Var&& temporary)
+		{
+			std::swap(bits, temporary.bits);
+			return *this;
+		}
+
+		// Tạo Object từ giá trị immediate, không tăng tham chiếu.
+		inline Object* materialize() const
+		{
+			switch (bits & TAG_MASK)
+			{
+			case TAG_I32:
+				return I32::from(i32_value());
+			case TAG_F32:
+				return F32::from(f32_value());
+			case TAG_I64:
+				return I64::from(i64_value());
+			case TAG_F64:
+				return F64::from(f64_value());
+			default:
+				return pointer();
+			}
+		}
+
+	public:
+
+		// True nếu giá trị được lưu trực tiếp, không có Object trên heap.
+		inline bool is_immediate() const
+		{
+			return (bits & TAG_MASK) != TAG_POINTER;
+		}
+
+		// Định danh kiểu mà không cần tạo Object.
+		// Var rỗng trả về TypeIndex::Unresolved.
+		inline TypeIndex type_index() const
+		{
+			switch (bits & TAG_MASK)
+			{
+			case TAG_I32:
+				return TypeIndex::I32;
+			case TAG_F32:
+				return TypeIndex::F32;
+			case TAG_I64:
+				return TypeIndex::I64;
+			case TAG_F64:
+				return TypeIndex::F64;
+			default:
+				return bits == 0u ? TypeIndex::Unresolved : pointer()->type_index();
+			}
+		}
+
+		// (!) : chỉ gọi khi type_index() == TypeIndex::I32.
+		inline i32 i32_value() const
+		{
+			if ((bits & TAG_MASK) == TAG_I32)
+				return i32(u32(bits >> 32));
+			return static_cast<const I32*>(pointer())->value;
+		}
+
+		// (!) : chỉ gọi khi type_index() == TypeIndex::F32.
+		inline f32 f32_value() const
+		{
+			if ((bits & TAG_MASK) != TAG_F32)
+				return static_cast<const F32*>(pointer())->value;
+
+			u32 pattern = u32(bits >> 32);
+			f32 value;
+			std::memcpy(&value, &pattern, sizeof(value));
+			return value;
+		}
+
+		// (!) : chỉ gọi khi type_index() == TypeIndex::I64.
+		inline i64 i64_value() const
+		{
+			if ((bits & TAG_MASK) == TAG_I64)
+				return i64(bits) >> 3;
+			return static_cast<const I64*>(pointer())->value;
+		}
+
+		// (!) : chỉ gọi khi type_index() == TypeIndex::F64.
+		inline f64 f64_value() const
+		{
+			if ((bits & TAG_MASK) != TAG_F64)
+				return static_cast<const F64*>(pointer())->value;
+
+			// Mũ thu gọn bằng 0 : ±0.0
+			u64 exponent = (bits >> 55) & 0xFFu;
+			u64 pattern = (bits & F64_SIGN) | ((bits >> 3) & F64_MANTISSA);
+			if (exponent != 0u)
+				pattern |= (exponent + IMMEDIATE_F64_EXPONENT_OFFSET) << 52;
+
+			f64 value;
+			std::memcpy(&value, &pattern, sizeof(value));
+			return value;
+		}
+
+		// Trả về Object và chuyển tham chiếu của Var cho người gọi, Var trở thành rỗng.
+		// Giá trị immediate được chuyển thành Object.
+		inline Object* release()
+		{
+			auto result = get();
+			bits = 0u;
+			return result;
+		}
+
+		// Trả về Object mà Var tham chiếu ( không tăng tham chiếu ).
+		// Giá trị immediate được chuyển thành Object và Var giữ Object đó.
+		inline Object* get()
+		{
+			if (is_immediate())
+				bits = encode_pointer(materialize());
+			return pointer();
+		}
+
+		template <class U, ENABLE_IF(!SAME(U, Object))>
+		inline U* bind()
+		{
+			if (bits == 0u)
+				return nullptr;
+
+			return OBJECT_CAST<U>(get());
+		}
+
+#pragma endregion
+
+#pragma region Overloading Operator Definition
+
+		inline Object* operator->()
+		{
+			return get();
+		}
+
+		inline operator bool()
+		{
+			return bits != 0u;
+		}
+
+		inline Object* operator&()
+		{
+			return get();
+		}
+
+
+		// So sánh định danh : cùng Object, hoặc cùng giá trị immediate.
+		inline bool operator==(Var& source)
+		{
+			return bits == source.bits;
+		}
+
+
+		inline Var& operator=(Object* object)
+		{
+			auto n_bits = encode_pointer(object);
+			safe();
+
+			bits = n_bits;
+			return *this;
+		}
+
+		inline Var& operator=(Var& source)
+		{
+			if (this == std::addressof(source))
+				return *this;
+
+			if (source.is_pointer())
+				INREF(source.pointer());
+			safe();
+
+			bits = source.bits;
+			return *this;
+		}
+
+		inline Var& operator=(Var&& source) noexcept
+		{
+			if (this == std::addressof(source))
+				return *this;
+
+			auto n_bits = source.bits;
+			source.bits = 0u;
+			safe();
+
+			bits = n_bits;
+			return *this;
+		}
+
+		template <class U, ENABLE_IF(!SAME(Object, U))>
+		inline Var& operator=(U* object)
+		{
+			return *this = (object != nullptr ? AS_OBJECT(object) : nullptr);
+		}
+
+		template <class U, ENABLE_IF(!SAME(Object, U))>
+		inline Var& operator=(Var<U>& source)
+		{
+			return *this = &source;
+		}
+
+#pragma region operator=(value)
+
+		inline Var& operator=(bool value)
+		{
+			return assign(Var(value));
+		}
+
+		inline Var& operator=(i32 value)
+		{
+			return assign(Var(value));
+		}
+
+		inline Var& operator=(i64 value)
+		{
+			return assign(Var(value));
+		}
+
+		inline Var& operator=(f32 value)
+		{
+			return assign(Var(value));
+		}
+
+		inline Var& operator=(f64 value)
+		{
+			return assign(Var(value));
+		}
+
+#pragma endregion
+
+		friend std::ostream& operator<<(std::ostream& os, Var& source)
+		{
+			switch (source.bits & TAG_MASK)
+			{
+			case TAG_I32:
+				os << source.i32_value();
+				break;
+			case TAG_F32:
+				os << source.f32_value();
+				break;
+			case TAG_I64:
+				os << source.i64_value();
+				break;
+			case TAG_F64:
+				os << source.f64_value();
+				break;
+			default:
+				if (source)
+					source.pointer()->output();
+				else
+					std::cout << "None";
+			}
+			return os;
+		}
+
+#pragma endregion
+
+	};
+
+#pragma endregion
+
 }
\ No newline at end of file
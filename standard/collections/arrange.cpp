@@ -148,8 +148,7 @@ namespace pycpp
 	{
 		if (cur != nullptr)
 		{
-			DEREF(cur);
-			SAFE(cur);
+			DECREF(cur);
 		}
 	}
 
@@ -159,6 +158,11 @@ namespace pycpp
 		return Range::iterator::type_id;
 	}
 
+	Object* Range::iterator::as_object()
+	{
+		return this;
+	}
+
 	std::string Range::iterator::class_name()
 	{
 		return "Range::iterator";
@@ -200,7 +204,7 @@ namespace pycpp
 
 		if (__is_valid && cur == nullptr)
 		{
-			cur = new I32(current);
+			cur = I32::from(current);
 			INREF(cur);
 		}
 
@@ -220,8 +224,7 @@ namespace pycpp
 			return;
 		}
 
-		DEREF(cur);
-		SAFE(cur);
+		DECREF(cur);
 		cur = nullptr;	// Khi lần gọi is_valid tới, 'cur' sẽ được gán.
 		current += step;
 	}
@@ -239,8 +242,7 @@ namespace pycpp
 			return;
 		}
 
-		DEREF(cur);
-		SAFE(cur);
+		DECREF(cur);
 		cur = nullptr;	// Khi lần gọi is_valid tới, 'cur' sẽ được gán.
 		current -= step;
 	}
@@ -20,7 +20,7 @@ namespace pycpp
 		i32 _start, _step, _end;
 
 	public:
-		TYPE_ID(Range);
+		BUILTIN_TYPE_ID(Range);
 
 		#pragma region Constructors & Destructors
 
@@ -73,7 +73,7 @@ namespace pycpp
 			I32* cur;
 
 		public:
-			TYPE_ID(Range::iterator);
+			BUILTIN_TYPE_ID(RangeIterator);
 
 			iterator(i32 current, i32 start, i32 end, i32 step);
 			~iterator();
@@ -82,6 +82,7 @@ namespace pycpp
 			//==========     Methods Object     ==========//
 
 			i64 type() override;
+			Object* as_object() override;
 			std::string class_name() override;
 			void output() override;
 			void output(std::string&) override;
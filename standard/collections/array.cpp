@@ -1,6 +1,7 @@
 #include "array.hpp"
 #include "../base/error.hpp"
 #include "../base/algo.hpp"
+#include "../base/sort.hpp"
 
 // #define _CRT_SECURE_NO_WARNINGS
 #pragma warning(disable : 4996)
@@ -35,12 +36,12 @@ namespace pycpp
 		init_from_array(source);	// Don't need SAFE(source)
 	}
 
-	__Array::__Array(Iterable* iterable)
+	__Array::__Array(Iterable* iterable) : __Array()
 	{
 		// Don't need to SAFE(iterable).
 
 		// Try cast to __Array
-		auto __array = dynamic_cast<__Array*>(iterable);
+		auto __array = as_array(iterable);
 		if (__array)
 		{
 			init_from_array(__array);
@@ -48,7 +49,7 @@ namespace pycpp
 		}
 
 		// Try cast to __HashTable
-		auto __hashtable = dynamic_cast<__HashTable*>(iterable);
+		auto __hashtable = as_hashtable(iterable);
 		if (__hashtable)
 		{
 			init_from_hashtable(__hashtable);
@@ -65,13 +66,18 @@ namespace pycpp
 
 		for (u32 i = 0u; i < len; ++i)
 		{
-			DEREF(data[i]);
-			SAFE(data[i]);
+			DECREF(data[i]);
 		}
 
 		delete[] data;
 	}
 
+	Object* __Array::as_object()
+	{
+		// Note : mọi class buộc phải kế thừa Object
+		return dynamic_cast<Object*>(this);
+	}
+
 		#pragma endregion
 
 		#pragma region Initialize Methods
@@ -105,7 +111,7 @@ namespace pycpp
 		SAFE(source);
 	}
 
-	void __Array::init_from_hashtable(const __HashTable* __hashtable)
+	void __Array::init_from_hashtable(__HashTable* __hashtable)
 	{
 		// Before using this methods, this should be an empty :
 		// data = nullptr | capacity = 0 | size = 0
@@ -113,19 +119,19 @@ namespace pycpp
 		if (__hashtable->len == 0u)
 			return;
 
+		__hashtable->finish_rehash();
 		len = __hashtable->len;
 		init_with_capacity(__Array::find_capacity(len));
 
-		Object* cur = nullptr;
-		for (u32 i = 0u; i < len; ++i)
+		u32 index = 0u;
+		for (u32 i = 0u; i < __hashtable->capacity; ++i)
 		{
-			cur = __hashtable->data[i]->ref;
+			if (__hashtable->is_full(i) == false)
+				continue;
 
-			if (cur != nullptr)
-			{
-				data[i] = cur;
-				INREF(data[i]);
-			}
+			data[index] = __hashtable->data[i].ref;
+			INREF(data[index]);
+			++index;
 		}
 
 		SAFE(__hashtable);
@@ -137,6 +143,8 @@ namespace pycpp
 
 	inline void __Array::grow_when_empty()
 	{
+		// "data" có thể là mảng rỗng ( khởi tạo từ danh sách rỗng )
+		delete[] data;
 		data = new Object * [1]{ nullptr };
 		capacity = 1u;
 	}
@@ -145,8 +153,7 @@ namespace pycpp
 	{
 		if (data[0] != nullptr)
 		{
-			DEREF(data[0]);
-			SAFE(data[0]);
+			DECREF(data[0]);
 		}
 
 		delete[] data;
@@ -192,8 +199,6 @@ namespace pycpp
 
 	void __Array::grow_and_insert(u32 index, Object* object)
 	{
-		INREF(object);
-
 		// Case 1 : array is empty
 		if (capacity == 0u)
 		{
@@ -297,7 +302,7 @@ namespace pycpp
 			return;
 
 		bool first = true;
-		Object* __this = dynamic_cast<Object*>(this);
+		Object* __this = as_object();
 		std::string str_cur;
 
 		for (u32 i = 0u; i < len; ++i)
@@ -320,8 +325,7 @@ namespace pycpp
 	{
 		for (u32 i = 0u; i < len; ++i)
 		{
-			DEREF(data[i]);
-			SAFE(data[i]);
+			DECREF(data[i]);
 		}
 
 		delete[] data;
@@ -338,9 +342,9 @@ namespace pycpp
 			pycpp::swap(data[i], data[j]);
 	}
 
-	void __Array::sort()
+	void __Array::sort(SortPolicy policy)
 	{
-		pycpp::shell_sort(data, len);
+		pycpp::sort_array(data, len, policy);
 	}
 
 	void __Array::shrink_to_fit()
@@ -369,7 +373,7 @@ namespace pycpp
 		{
 			char block_location[32];
 			std::sprintf(block_location, "%s::get(i32)",
-				dynamic_cast<Object*>(this)->class_name().c_str());
+				as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 			return nullptr;
@@ -386,7 +390,7 @@ namespace pycpp
 		{
 			char block_location[32];
 			std::sprintf(block_location, "%s::assign(i32, Object)",
-				dynamic_cast<Object*>(this)->class_name().c_str());
+				as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 			return;
@@ -401,8 +405,7 @@ namespace pycpp
 		Object* deleting = *ptr;
 		*ptr = item;
 
-		DEREF(deleting);
-		SAFE(deleting);
+		DECREF(deleting);
 	}
 
 	void __Array::multi_assign(Range* range, Iterable* iterable)
@@ -429,7 +432,7 @@ namespace pycpp
 			std::sprintf(content_error,
 				"Error in %s::multi_assign(Range*, Iterable*) : "
 				"the number of elements of Range and Iterables must be equal !",
-				dynamic_cast<Object*>(this)->class_name().c_str());
+				as_object()->class_name().c_str());
 			std::cout << content_error << std::endl;
 
 			throw std::exception("Error : the number of elements of two Iterables must be equal !");
@@ -458,22 +461,35 @@ namespace pycpp
 
 
 	void __Array::push(Object* item)
+	{
+		INREF(item);
+		push_steal(item);
+	}
+
+	void __Array::push_steal(Object* item)
 	{
 		if (len == capacity)
 			grow();
 
-		INREF(item);
 		data[len++] = item;
 	}
 
 	void __Array::insert(i32 index, Object* item)
+	{
+		INREF(item);
+		insert_steal(index, item);
+	}
+
+	void __Array::insert_steal(i32 index, Object* item)
 	{
 		// Error : out of bound
 		if (index < -i32(len) || index > i32(len))
 		{
+			DECREF(item);
+
 			char block_location[64];
 			std::sprintf(block_location,
-				"%s::insert", dynamic_cast<Object*>(this)->class_name().c_str());
+				"%s::insert", as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 		}
@@ -483,12 +499,10 @@ namespace pycpp
 
 		if (len == capacity)
 		{
-			// Don't need INREF(item)
 			grow_and_insert(index, item);
 			return;
 		}
 
-		INREF(item);
 		for (u32 i = len; i > u32(index); --i)
 			data[i] = data[i - 1u];
 		data[index] = item;
@@ -502,7 +516,7 @@ namespace pycpp
 		{
 			char block_location[64];
 			std::sprintf(block_location,
-				"%s::pop", dynamic_cast<Object*>(this)->class_name().c_str());
+				"%s::pop", as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 		}
@@ -531,7 +545,7 @@ namespace pycpp
 		{
 			char block_location[64];
 			std::sprintf(block_location,
-				"%s::remove", dynamic_cast<Object*>(this)->class_name().c_str());
+				"%s::remove", as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 		}
@@ -547,8 +561,7 @@ namespace pycpp
 		}
 
 		auto deleting = data[index];
-		DEREF(deleting);
-		SAFE(deleting);
+		DECREF(deleting);
 
 		// Move
 		for (u32 i = index + 1; i < len; ++i)
@@ -561,7 +574,7 @@ namespace pycpp
 		// Don't need SAFE(iterable)
 
 		// Try to cast "iterable" to "__Array"
-		auto __array = dynamic_cast<__Array*>(iterable);
+		auto __array = as_array(iterable);
 		if (__array)
 		{
 			extend_from_array(__array);
@@ -569,7 +582,7 @@ namespace pycpp
 		}
 
 		// Try to cast "iterable" to "__Array"
-		auto __hashtable = dynamic_cast<__HashTable*>(iterable);
+		auto __hashtable = as_hashtable(iterable);
 		if (__hashtable)
 		{
 			extend_from_hashtable(__hashtable);
@@ -663,6 +676,12 @@ namespace pycpp
 		len *= multiplier;
 	}
 
+	void __Array::traverse(TraverseVisitor visit, void* context)
+	{
+		for (u32 i = 0u; i < len; ++i)
+			visit(data[i], context);
+	}
+
 	void __Array::extend_from_iterable(Iterable* iterable)
 	{
 		Object* cur = nullptr;
@@ -718,7 +737,7 @@ namespace pycpp
 		SAFE(other);
 	}
 
-	void __Array::extend_from_hashtable(const __HashTable* source)
+	void __Array::extend_from_hashtable(__HashTable* source)
 	{
 		// TODO
 	}
@@ -737,8 +756,7 @@ namespace pycpp
 
 	__Array::iterator::~iterator()
 	{
-		DEREF(source);
-		SAFE(source);
+		DECREF(source);
 	}
 
 
@@ -747,6 +765,11 @@ namespace pycpp
 		return __Array::iterator::type_id;
 	}
 
+	Object* __Array::iterator::as_object()
+	{
+		return this;
+	}
+
 	std::string __Array::iterator::class_name()
 	{
 		return "__Array::iterator";
@@ -769,7 +792,7 @@ namespace pycpp
 		{
 			char block_location[64];
 			std::sprintf(block_location, "%s::iterator::next",
-				dynamic_cast<Object*>(source)->class_name().c_str());
+				source->as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 			return;
@@ -784,7 +807,7 @@ namespace pycpp
 		{
 			char block_location[64];
 			std::sprintf(block_location, "%s::iterator::prev",
-				dynamic_cast<Object*>(source)->class_name().c_str());
+				source->as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 			return;
@@ -799,7 +822,7 @@ namespace pycpp
 		{
 			char block_location[64];
 			std::sprintf(block_location, "%s::iterator::get",
-				dynamic_cast<Object*>(source)->class_name().c_str());
+				source->as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 			return nullptr;
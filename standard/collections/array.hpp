@@ -2,6 +2,8 @@
 
 #include "../base/object.hpp"
 #include "../base/algo.hpp"
+#include "../base/sort.hpp"
+#include "../base/collector.hpp"
 #include "iterable.hpp"
 #include "arrange.hpp"
 #include "private_hashtable.hpp"
@@ -14,6 +16,12 @@ namespace pycpp
 	class __HashTable;
 	class Deque;
 	class OrderedMap;
+	class View;
+
+	template <typename T>
+	class TypedArray;
+
+	struct __NumericSequence;
 
 #pragma region Declaration : Private Array
 
@@ -22,6 +30,11 @@ namespace pycpp
 		friend __HashTable;
 		friend Deque;
 		friend OrderedMap;
+		friend View;
+
+		template <typename T>
+		friend class TypedArray;
+		friend __NumericSequence;
 
 	#pragma region __Array
 
@@ -46,7 +59,7 @@ namespace pycpp
 
 		void init_with_capacity(u32 n_capacity);
 		void init_from_array(const __Array*);
-		void init_from_hashtable(const __HashTable*);
+		void init_from_hashtable(__HashTable*);
 
 		#pragma endregion
 
@@ -76,7 +89,7 @@ namespace pycpp
 		// Tăng dung lượng.
 		void grow();
 
-		// Điều kiện : "index" hợp lệ.
+		// Điều kiện : "index" hợp lệ, "object" đã được tăng tham chiếu.
 		void grow_and_insert(u32 index, Object* object);
 
 		// Giảm dung lượng.
@@ -96,7 +109,7 @@ namespace pycpp
 		void output(std::string& out);
 		void clear();
 		void reverse();
-		void sort();
+		void sort(SortPolicy policy = PYCPP_SORT_POLICY);
 		void shrink_to_fit();
 		bool contains(Object*);
 
@@ -108,6 +121,11 @@ namespace pycpp
 
 		void push(Object*);
 		void insert(i32 index, Object*);
+
+		// Tương tự "push" / "insert" nhưng nhận luôn tham chiếu của người gọi ( không INREF ).
+		void push_steal(Object*);
+		void insert_steal(i32 index, Object*);
+
 		Object* pop(i32 index);
 		void remove(i32 index);
 		
@@ -127,7 +145,10 @@ namespace pycpp
 
 		void extend_from_iterable(Iterable*);
 		void extend_from_array(const __Array* source);
-		void extend_from_hashtable(const __HashTable* source);
+		void extend_from_hashtable(__HashTable* source);
+
+		// Gọi "visit" với mỗi phần tử.
+		void traverse(TraverseVisitor visit, void* context);
 
 		#pragma endregion
 
@@ -135,6 +156,9 @@ namespace pycpp
 
 	public:
 
+		// Trả về Object triển khai __Array ( không tăng tham chiếu ).
+		virtual Object* as_object();
+
 	#pragma region Iterator
 
 		class iterator final : public Iterator, public Object
@@ -147,9 +171,10 @@ namespace pycpp
 			~iterator();
 
 		public:
-			TYPE_ID(__Array::iterator);
+			BUILTIN_TYPE_ID(ArrayIterator);
 
 			i64 type() override;
+			Object* as_object() override;
 			std::string class_name() override;
 			u32 bytes() override;
 
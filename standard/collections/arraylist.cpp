@@ -32,6 +32,11 @@ namespace pycpp
 		return ArrayList::type_id;
 	}
 
+	Object* ArrayList::as_object()
+	{
+		return this;
+	}
+
 	std::string ArrayList::class_name()
 	{
 		return "ArrayList";
@@ -54,6 +59,16 @@ namespace pycpp
 		return pycpp::hash_array(data, len);
 	}
 
+	void ArrayList::traverse(TraverseVisitor visit, void* context)
+	{
+		__Array::traverse(visit, context);
+	}
+
+	void ArrayList::clear_references()
+	{
+		__Array::clear();
+	}
+
 	void ArrayList::output()
 	{
 		std::string content;
@@ -72,11 +87,11 @@ namespace pycpp
 
 	bool ArrayList::equal(Object* other)
 	{
-		auto arguments = dynamic_cast<Arguments*>(other);
+		auto arguments = as_arguments(other);
 		if (arguments == nullptr)
 			return false;
 
-		auto __array = dynamic_cast<__Array*>(other);
+		auto __array = as_array(other);
 		if (__array)
 			return __Array::equal(__array);
 		return Arguments::equal(arguments);
@@ -84,7 +99,7 @@ namespace pycpp
 
 	i32 ArrayList::rich_compare(Object* other)
 	{
-		auto arguments = dynamic_cast<Arguments*>(other);
+		auto arguments = as_arguments(other);
 		if (arguments == nullptr)
 		{
 			char content_error[128];
@@ -100,7 +115,7 @@ namespace pycpp
 			return 0;
 		}
 
-		auto __array = dynamic_cast<__Array*>(other);
+		auto __array = as_array(other);
 		if (__array)
 			return __Array::rich_compare(__array);
 		return Arguments::rich_compare(arguments);
@@ -109,7 +124,7 @@ namespace pycpp
 
 	Object* ArrayList::add(Object* other)
 	{
-		auto iterable = dynamic_cast<Iterable*>(other);
+		auto iterable = as_iterable(other);
 		if (iterable == nullptr)
 		{
 			char content_error[128];
@@ -137,11 +152,11 @@ namespace pycpp
 		switch (other_type)
 		{
 		case I32::type_id:
-			num = dynamic_cast<I32*>(other)->value;
+			num = static_cast<I32*>(other)->value;
 			break;
 
 		case I64::type_id:
-			num = (i32) dynamic_cast<I64*>(other)->value;
+			num = (i32) static_cast<I64*>(other)->value;
 			break;
 
 		default:
@@ -251,20 +266,8 @@ namespace pycpp
 
 	void ArrayList::set(i32 index, Object* item)
 	{
-		if (index < -i32(len) || index >= i32(len))
-		{
-			__pycpp_error_out_of_bound("ArrayList::set(i32 index, Object item)");
-			return;
-		}
-
-		if (index < 0)
-			index += len;
-		auto deleting = data[index];
-		DEREF(deleting);
-		SAFE(deleting);
-
 		INREF(item);
-		data[index] = item;
+		set_steal(index, item);
 	}
 
 	void ArrayList::insert(i32 index, Object* item)
@@ -287,6 +290,42 @@ namespace pycpp
 		__Array::sort();
 	}
 
+	void ArrayList::sort(SortPolicy policy)
+	{
+		__Array::sort(policy);
+	}
+
+	#pragma endregion
+
+	#pragma region Steal Reference
+
+	void ArrayList::push_steal(Object* item)
+	{
+		__Array::push_steal(item);
+	}
+
+	void ArrayList::set_steal(i32 index, Object* item)
+	{
+		if (index < -i32(len) || index >= i32(len))
+		{
+			DECREF(item);
+			__pycpp_error_out_of_bound("ArrayList::set(i32 index, Object item)");
+			return;
+		}
+
+		if (index < 0)
+			index += len;
+		auto deleting = data[index];
+		DECREF(deleting);
+
+		data[index] = item;
+	}
+
+	void ArrayList::insert_steal(i32 index, Object* item)
+	{
+		__Array::insert_steal(index, item);
+	}
+
 	#pragma endregion
 
 #pragma endregion
@@ -9,9 +9,11 @@ namespace pycpp
 
 	class ArrayList final : public List, public __Array
 	{
+		// Được theo dõi bởi bộ thu gom chu trình.
+		__GCNode gc_node{ this };
 
 	public:
-		TYPE_ID(ArrayList);
+		BUILTIN_TYPE_ID(ArrayList);
 
 	#pragma region Array List
 
@@ -29,11 +31,14 @@ namespace pycpp
 		#pragma region Override Object
 
 		i64 type() override;
+		Object* as_object() override;
 		std::string class_name() override;
 		void output() override;
 		void output(std::string&) override;
 		u32 bytes() override;
 		u64 hash() override;
+		void traverse(TraverseVisitor visit, void* context) override;
+		void clear_references() override;
 
 		bool equal(Object*) override;
 		i32 rich_compare(Object*) override;
@@ -91,9 +96,28 @@ namespace pycpp
 		// Xóa một phần tử tại vị trí "index".
 		void remove(i32 index) override;
 
-		// Sắp xếp tăng dần
+		// Sắp xếp tăng dần ( ổn định, xem PYCPP_SORT_POLICY )
 		void sort() override;
 
+		// Sắp xếp tăng dần với thuật toán "policy".
+		void sort(SortPolicy policy);
+
+		#pragma endregion
+
+		#pragma region Steal Reference
+
+		// Các hàm "steal" nhận luôn tham chiếu của người gọi ( không INREF ) :
+		// list->push_steal(var.release()).
+
+		// Thêm phần tử vào cuối List.
+		void push_steal(Object* item);
+
+		// Gán mới phần tử tại vị trí "index".
+		void set_steal(i32 index, Object* item);
+
+		// Chèn một phần tử vào vị trí "index".
+		void insert_steal(i32 index, Object* item);
+
 		#pragma endregion
 
 	#pragma endregion
@@ -1,4 +1,7 @@
 #include "deque.hpp"
+#include "../base/sort.hpp"
+
+#include <vector>
 
 // #define _CRT_SECURE_NO_WARNINGS
 #pragma warning(disable : 4996)
@@ -126,6 +129,11 @@ namespace pycpp
 		return Deque::type_id;
 	}
 
+	Object* Deque::as_object()
+	{
+		return this;
+	}
+
 	std::string Deque::class_name()
 	{
 		return "Deque";
@@ -191,10 +199,21 @@ namespace pycpp
 		return new Deque(*this);
 	}
 
+	void Deque::traverse(TraverseVisitor visit, void* context)
+	{
+		for (auto iter = head; iter; iter = iter->next)
+			visit(iter->ref, context);
+	}
+
+	void Deque::clear_references()
+	{
+		clear();
+	}
+
 
 	bool Deque::equal(Object* other)
 	{
-		auto arguments = dynamic_cast<Arguments*>(other);
+		auto arguments = as_arguments(other);
 		if (arguments == nullptr)
 			return false;
 
@@ -203,7 +222,7 @@ namespace pycpp
 
 	i32 Deque::rich_compare(Object* other)
 	{
-		auto arguments = dynamic_cast<Arguments*>(other);
+		auto arguments = as_arguments(other);
 		if (arguments == nullptr)
 		{
 			char content_error[128];
@@ -224,7 +243,7 @@ namespace pycpp
 
 	Object* Deque::add(Object* other)
 	{
-		auto iterable = dynamic_cast<Iterable*>(other);
+		auto iterable = as_iterable(other);
 		if (iterable == nullptr)
 		{
 			char content_error[128];
@@ -252,11 +271,11 @@ namespace pycpp
 		switch (other_type)
 		{
 		case I32::type_id:
-			num = dynamic_cast<I32*>(other)->value;
+			num = static_cast<I32*>(other)->value;
 			break;
 
 		case I64::type_id:
-			num = (i32) dynamic_cast<I64*>(other)->value;
+			num = (i32) static_cast<I64*>(other)->value;
 			break;
 
 		default:
@@ -337,15 +356,8 @@ namespace pycpp
 
 	bool Deque::push(Object* item)
 	{
-		if (len == 0u)
-		{
-			head = tail = new __DLNode(item);
-			len = 1u;
-			return true;
-		}
-
-		tail->next = new __DLNode(item);
-		++len;
+		INREF(item);
+		push_steal(item);
 		return true;
 	}
 
@@ -384,7 +396,7 @@ namespace pycpp
 		// Don't need SAFE(iterable)
 
 		// Try to cast "iterable" to "__Array"
-		auto __array = dynamic_cast<__Array*>(iterable);
+		auto __array = as_array(iterable);
 		if (__array)
 		{
 			extend_from_array(__array);
@@ -392,7 +404,7 @@ namespace pycpp
 		}
 
 		// Try to cast "iterable" to "__Array"
-		auto __hashtable = dynamic_cast<__HashTable*>(iterable);
+		auto __hashtable = as_hashtable(iterable);
 		if (__hashtable)
 		{
 			extend_from_hashtable(__hashtable);
@@ -438,11 +450,12 @@ namespace pycpp
 
 	bool Deque::equal(Arguments* arguments)
 	{
-		auto deque = dynamic_cast<Deque*>(arguments);
+		auto object = arguments->as_object();
+		auto deque = OBJECT_CAST<Deque>(object);
 		if (deque)
 			return equal_with_deque(deque);
 
-		auto __array = dynamic_cast<__Array*>(arguments);
+		auto __array = as_array(object);
 		if (__array)
 			return equal_with_array(__array);
 
@@ -451,11 +464,12 @@ namespace pycpp
 
 	i32 Deque::rich_compare(Arguments* arguments)
 	{
-		auto deque = dynamic_cast<Deque*>(arguments);
+		auto object = arguments->as_object();
+		auto deque = OBJECT_CAST<Deque>(object);
 		if (deque)
 			return rich_compare_with_deque(deque);
 
-		auto __array = dynamic_cast<__Array*>(arguments);
+		auto __array = as_array(object);
 		if (__array)
 			return rich_compare_with_array(__array);
 
@@ -473,65 +487,14 @@ namespace pycpp
 
 	void Deque::set(i32 index, Object* item)
 	{
-		if (index < -i32(len) || index >= i32(len))
-		{
-			__pycpp_error_out_of_bound("ArrayList::set(i32 index, Object item)");
-			return;
-		}
-
-		if (index < 0)
-			index += len;
-
-		auto selected_node = (index < (len >> 1)) ?
-			get_left(index) : get_right(len - u32(index) - 1u);
-		auto deleting = selected_node->pop();
-		DEREF(deleting);
-		SAFE(deleting);
-
 		INREF(item);
-		selected_node->ref = item;
+		set_steal(index, item);
 	}
 
 	void Deque::insert(i32 index, Object* item)
 	{
-		// Error : out of bound
-		if (index < -i32(len) || index > i32(len))
-		{
-			__pycpp_error_out_of_bound("Deque::insert(i32 index, Object item)");
-			return;
-		}
-
-		if (index < 0)
-			index += len;
-
-		auto element_node = new __DLNode(item);
-		++len;
-
-		// Insert head
-		if (index == 0)
-		{
-			element_node->next = head;
-			head = element_node;
-			return;
-		}
-
-		// Insert tail->next
-		if (index == i32(len))
-		{
-			tail->next = element_node;
-			tail = element_node;
-			return;
-		}
-
-		auto specified_node = (u32(index) < (len >> 1)) ?
-			get_left(u32(index)) : get_right(len - u32(index) - 1u);
-		auto previous_node = specified_node->prev;
-
-		// Linking
-		previous_node->next = element_node;
-		element_node->prev = previous_node;
-		element_node->next = specified_node;
-		specified_node->prev = element_node;
+		INREF(item);
+		insert_steal(index, item);
 	}
 
 	Object* Deque::pop(i32 index)
@@ -631,11 +594,117 @@ namespace pycpp
 
 	void Deque::sort()
 	{
+		// Chỉ chứa I32 / I64 / F32 / F64 : sắp xếp theo cơ số trên mảng con trỏ rồi ghi lại vào các node
+		if (len >= PYCPP_RADIX_SORT_THRESHOLD)
+		{
+			std::vector<Object*> values(len);
+
+			u32 i = 0u;
+			for (__DLNode* node = head; node != nullptr; node = node->next)
+				values[i++] = node->ref;
+
+			if (radix_sort(values.data(), len))
+			{
+				i = 0u;
+				for (__DLNode* node = head; node != nullptr; node = node->next)
+					node->ref = values[i++];
+				return;
+			}
+		}
+
 		Deque::merge_sort(head, tail, len);
 	}
 
 		#pragma endregion
 
+		#pragma region Steal Reference
+
+	void Deque::push_steal(Object* item)
+	{
+		auto element_node = new __DLNode(item, STEAL_REFERENCE);
+
+		if (len == 0u)
+		{
+			head = tail = element_node;
+			len = 1u;
+			return;
+		}
+
+		tail->next = element_node;
+		element_node->prev = tail;
+		tail = element_node;
+		++len;
+	}
+
+	void Deque::set_steal(i32 index, Object* item)
+	{
+		if (index < -i32(len) || index >= i32(len))
+		{
+			DECREF(item);
+			__pycpp_error_out_of_bound("Deque::set(i32 index, Object item)");
+			return;
+		}
+
+		if (index < 0)
+			index += len;
+
+		auto selected_node = (index < (len >> 1)) ?
+			get_left(index) : get_right(len - u32(index) - 1u);
+
+		// "pop" đã giảm tham chiếu
+		auto deleting = selected_node->pop();
+		SAFE(deleting);
+
+		selected_node->ref = item;
+	}
+
+	void Deque::insert_steal(i32 index, Object* item)
+	{
+		// Error : out of bound
+		if (index < -i32(len) || index > i32(len))
+		{
+			DECREF(item);
+			__pycpp_error_out_of_bound("Deque::insert(i32 index, Object item)");
+			return;
+		}
+
+		if (index < 0)
+			index += len;
+
+		// Insert tail->next ( kể cả Deque rỗng )
+		if (u32(index) == len)
+		{
+			push_steal(item);
+			return;
+		}
+
+		auto element_node = new __DLNode(item, STEAL_REFERENCE);
+
+		// Insert head
+		if (index == 0)
+		{
+			element_node->next = head;
+			head->prev = element_node;
+			head = element_node;
+			++len;
+			return;
+		}
+
+		// Tìm node theo "len" cũ
+		auto specified_node = (u32(index) < (len >> 1)) ?
+			get_left(u32(index)) : get_right(len - u32(index) - 1u);
+		auto previous_node = specified_node->prev;
+
+		// Linking
+		previous_node->next = element_node;
+		element_node->prev = previous_node;
+		element_node->next = specified_node;
+		specified_node->prev = element_node;
+		++len;
+	}
+
+		#pragma endregion
+
 		#pragma region Private Methods
 
 	u64 Deque::hash_value()
@@ -879,17 +948,14 @@ namespace pycpp
 		if (len == 0u)
 			head = tail = &tmp;
 
+		source->finish_rehash();
 		for (u32 i = 0u; i < source->capacity; ++i)
 		{
-			auto head = source->data[i];
-			if (head == nullptr)
+			if (source->is_full(i) == false)
 				continue;
 
-			for (; head; head = head->next)
-			{
-				tail->next = new __DLNode(head->ref);
-				tail = tail->next;
-			}
+			tail->next = new __DLNode(source->data[i].ref);
+			tail = tail->next;
 		}
 
 		if (len == 0u)
@@ -1044,8 +1110,7 @@ namespace pycpp
 
 	Deque::iterator::~iterator()
 	{
-		DEREF(container);
-		SAFE(container);
+		DECREF(container);
 	}
 
 
@@ -1054,6 +1119,11 @@ namespace pycpp
 		return Deque::iterator::type_id;
 	}
 
+	Object* Deque::iterator::as_object()
+	{
+		return this;
+	}
+
 	std::string Deque::iterator::class_name()
 	{
 		return "Deque::iterator";
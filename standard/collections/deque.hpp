@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../base/allocator.hpp"
+#include "../base/collector.hpp"
 #include "iterable.hpp"
 #include "array.hpp"
 #include "private_hashtable.hpp"
@@ -13,8 +15,10 @@ namespace pycpp
 
 #pragma region Declaration : Node
 
-	struct __DLNode
+	struct __DLNode final
 	{
+		SLAB_ALLOCATOR(__DLNode);
+
 		Object* ref;
 		__DLNode* next;
 		__DLNode* prev;
@@ -27,6 +31,10 @@ namespace pycpp
 			INREF(ref);
 		}
 
+		// Nhận luôn tham chiếu của người gọi.
+		inline __DLNode(Object* reference, __StealReference) :
+			ref(reference), next(nullptr), prev(nullptr) {}
+
 		inline Object* pop()
 		{
 			auto result = ref;
@@ -39,8 +47,7 @@ namespace pycpp
 		{
 			if (ref)
 			{
-				DEREF(ref);
-				SAFE(ref);
+				DECREF(ref);
 			}
 		}
 	};
@@ -59,8 +66,11 @@ namespace pycpp
 		__DLNode* tail;
 		u32 len;
 
+		// Được theo dõi bởi bộ thu gom chu trình.
+		__GCNode gc_node{ this };
+
 	public:
-		TYPE_ID(Deque);
+		BUILTIN_TYPE_ID(Deque);
 
 		class iterator;
 		friend iterator;
@@ -88,12 +98,15 @@ namespace pycpp
 		#pragma region Override Object
 
 		i64 type() override;
+		Object* as_object() override;
 		std::string class_name() override;
 		void output() override;
 		void output(std::string& out) override;
 		u64 hash() override;
 		u32 bytes() override;
 		Object* copy() override;
+		void traverse(TraverseVisitor visit, void* context) override;
+		void clear_references() override;
 
 		bool equal(Object* other) override;
 		i32 rich_compare(Object* other) override;
@@ -161,11 +174,27 @@ namespace pycpp
 		// Xóa một phần tử tại vị trí "index".
 		void remove(i32 index) override;
 
-		// Sắp xếp tăng dần
+		// Sắp xếp tăng dần ( "radix_sort" khi mọi phần tử cùng là I32, I64, F32 hoặc F64 )
 		void sort() override;
 
 		#pragma endregion
 
+		#pragma region Steal Reference
+
+		// Các hàm "steal" nhận luôn tham chiếu của người gọi ( không INREF ) :
+		// deque->push_steal(var.release()).
+
+		// Thêm phần tử vào cuối Deque.
+		void push_steal(Object* item);
+
+		// Gán mới phần tử tại vị trí "index".
+		void set_steal(i32 index, Object* item);
+
+		// Chèn một phần tử vào vị trí "index".
+		void insert_steal(i32 index, Object* item);
+
+		#pragma endregion
+
 		#pragma region Standard Methods
 
 
@@ -220,11 +249,12 @@ namespace pycpp
 		public:
 			~iterator();
 
-			TYPE_ID(Deque::iterator);
+			BUILTIN_TYPE_ID(DequeIterator);
 
 			//==========     Override Object     ==========//
 
 			i64 type() override;
+			Object* as_object() override;
 			std::string class_name() override;
 			u32 bytes() override;
 
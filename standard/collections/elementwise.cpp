@@ -0,0 +1,493 @@
+#include "elementwise.hpp"
+#include "../base/numeric.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+// #define _CRT_SECURE_NO_WARNINGS
+#pragma warning(disable : 4996)
+
+namespace pycpp
+{
+
+#pragma region Operand
+
+	static void elementwise_error(const char* block_location, const char* message)
+	{
+		char content_error[128];
+		sprintf_s(content_error, "Error in %s : %s !", block_location, message);
+
+		std::cout << content_error << std::endl;
+		throw std::exception("Error : invalid operand of elementwise operation");
+	}
+
+	// Toán hạng : dãy số ( "sequence" đồng nhất ) hoặc số ( "scalar" ).
+	// Giữ tham chiếu đến Object nguồn và TypedArray tạm cho tới khi bị hủy ( kể cả khi ném lỗi ).
+	struct __ElementwiseOperand
+	{
+		__NumericSequence sequence;
+		Object* scalar = nullptr;
+
+		Object* source = nullptr;
+		List* holder = nullptr;
+
+		__ElementwiseOperand() = default;
+		__ElementwiseOperand(const __ElementwiseOperand&) = delete;
+
+		~__ElementwiseOperand()
+		{
+			if (holder)
+				DECREF(holder);
+			if (source)
+				DECREF(source);
+		}
+
+		inline bool is_sequence() const
+		{
+			return scalar == nullptr;
+		}
+	};
+
+	// Đọc một số cho mọi vị trí ( broadcast ).
+	template <typename T>
+	struct __ScalarLoader
+	{
+		using value_type = T;
+		T value;
+
+		inline T operator()(u32) const
+		{
+			return value;
+		}
+	};
+
+	// Chuyển dãy không đồng nhất sang TypedArray của kiểu bao quát nhất trong dãy.
+	static void operand_materialize(__ElementwiseOperand& operand, Iterable* iterable, const char* block_location)
+	{
+		// Boolean được xem như I32
+		i32 slot = numeric_slot(TypeIndex::I32);
+
+		auto iter = iterable->first();
+		for (; iter->is_valid(); iter->next())
+		{
+			i32 item_slot = numeric_slot(iter->get()->type_index());
+			if (item_slot < 0)
+			{
+				SAFE(iter);
+				elementwise_error(block_location, "element of the sequence is not a number");
+			}
+
+			if (item_slot > slot)
+				slot = item_slot;
+		}
+		SAFE(iter);
+
+		switch (slot)
+		{
+		case 1:
+			operand.holder = new I32Array(iterable);
+			break;
+		case 2:
+			operand.holder = new I64Array(iterable);
+			break;
+		case 3:
+			operand.holder = new F32Array(iterable);
+			break;
+		default:
+			operand.holder = new F64Array(iterable);
+			break;
+		}
+
+		INREF(operand.holder);
+		operand.sequence = __NumericSequence::from(operand.holder);
+	}
+
+	static void operand_of(__ElementwiseOperand& operand, Object* object, const char* block_location)
+	{
+		INREF(object);
+		operand.source = object;
+
+		if (is_numeric(object))
+		{
+			operand.scalar = object;
+			return;
+		}
+
+		auto iterable = as_iterable(object);
+		if (iterable == nullptr)
+			elementwise_error(block_location, "operand must be a number or an Iterable of numbers");
+
+		operand.sequence = __NumericSequence::from(iterable);
+		if (operand.sequence.is_homogeneous() == false)
+			operand_materialize(operand, iterable, block_location);
+	}
+
+	// Gọi "function(loader)" với loader tương ứng kiểu của số "scalar".
+	template <typename Function>
+	static List* scalar_dispatch(Object* scalar, Function&& function)
+	{
+		switch (scalar->type_index())
+		{
+		case TypeIndex::Boolean:
+			return function(__ScalarLoader<i32>{ IS(scalar, TRUE) ? 1 : 0 });
+		case TypeIndex::I32:
+			return function(__ScalarLoader<i32>{ static_cast<I32*>(scalar)->value });
+		case TypeIndex::I64:
+			return function(__ScalarLoader<i64>{ static_cast<I64*>(scalar)->value });
+		case TypeIndex::F32:
+			return function(__ScalarLoader<f32>{ static_cast<F32*>(scalar)->value });
+		default:
+			return function(__ScalarLoader<f64>{ static_cast<F64*>(scalar)->value });
+		}
+	}
+
+	// Gọi "function(loader)" với loader tương ứng của toán hạng.
+	template <typename Function>
+	static List* operand_dispatch(const __ElementwiseOperand& operand, Function&& function)
+	{
+		if (operand.is_sequence())
+			return __numeric_dispatch(operand.sequence, function);
+		return scalar_dispatch(operand.scalar, function);
+	}
+
+	// Giá trị của số "bound" ép về kiểu B.
+	template <typename B>
+	static inline B bound_value(Object* bound)
+	{
+		if constexpr (std::is_same_v<B, i32>)
+			return I32::init_from_object(bound);
+		else if constexpr (std::is_same_v<B, i64>)
+			return I64::init_from_object(bound);
+		else if constexpr (std::is_same_v<B, f32>)
+			return F32::init_from_object(bound);
+		else
+			return F64::init_from_object(bound);
+	}
+
+#pragma endregion
+
+#pragma region Operators
+
+	// Số nguyên tràn số được quay vòng như khi tính trên từng Object.
+	template <typename C, bool = std::is_integral_v<C>>
+	struct __wrap { using type = C; };
+
+	template <typename C>
+	struct __wrap<C, true> { using type = std::make_unsigned_t<C>; };
+
+	template <typename C>
+	using __wrap_t = typename __wrap<C>::type;
+
+	// Kiểu kết quả của div : số nguyên chuyển sang F32.
+	template <typename P>
+	using __floating_t = std::conditional_t<std::is_integral_v<P>, f32, P>;
+
+	struct __OperatorAdd
+	{
+		template <typename P> using compute_t = P;
+		template <typename P> using result_t = P;
+
+		template <typename C>
+		static inline C apply(C a, C b) { return C(__wrap_t<C>(a) + __wrap_t<C>(b)); }
+	};
+
+	struct __OperatorSub
+	{
+		template <typename P> using compute_t = P;
+		template <typename P> using result_t = P;
+
+		template <typename C>
+		static inline C apply(C a, C b) { return C(__wrap_t<C>(a) - __wrap_t<C>(b)); }
+	};
+
+	struct __OperatorMul
+	{
+		template <typename P> using compute_t = P;
+		template <typename P> using result_t = P;
+
+		template <typename C>
+		static inline C apply(C a, C b) { return C(__wrap_t<C>(a) * __wrap_t<C>(b)); }
+	};
+
+	struct __OperatorDiv
+	{
+		template <typename P> using compute_t = __floating_t<P>;
+		template <typename P> using result_t = __floating_t<P>;
+
+		template <typename C>
+		static inline C apply(C a, C b) { return a / b; }
+	};
+
+	// So sánh trên kiểu bao quát, kết quả 0 / 1.
+#define PYCPP_ELEMENTWISE_COMPARE(Name, expression)	\
+	struct Name	\
+	{	\
+		template <typename P> using compute_t = P;	\
+		template <typename P> using result_t = i32;	\
+		\
+		template <typename C>	\
+		static inline i32 apply(C a, C b) { return i32(expression); }	\
+	}
+
+	PYCPP_ELEMENTWISE_COMPARE(__OperatorEqual, a == b);
+	PYCPP_ELEMENTWISE_COMPARE(__OperatorNotEqual, a != b);
+	PYCPP_ELEMENTWISE_COMPARE(__OperatorLess, a < b);
+	PYCPP_ELEMENTWISE_COMPARE(__OperatorLessEqual, a <= b);
+	PYCPP_ELEMENTWISE_COMPARE(__OperatorGreater, a > b);
+	PYCPP_ELEMENTWISE_COMPARE(__OperatorGreaterEqual, a >= b);
+
+#undef PYCPP_ELEMENTWISE_COMPARE
+
+	// Hàm toán học : F32 giữ nguyên, các kiểu còn lại tính trên F64.
+	template <typename V>
+	using __math_t = std::conditional_t<std::is_same_v<V, f32>, f32, f64>;
+
+	struct __OperatorSqrt
+	{
+		template <typename V> using result_t = __math_t<V>;
+
+		template <typename R>
+		static inline R apply(R x) { return std::sqrt(x); }
+	};
+
+	struct __OperatorExp
+	{
+		template <typename V> using result_t = __math_t<V>;
+
+		template <typename R>
+		static inline R apply(R x) { return std::exp(x); }
+	};
+
+	struct __OperatorLog
+	{
+		template <typename V> using result_t = __math_t<V>;
+
+		template <typename R>
+		static inline R apply(R x) { return std::log(x); }
+	};
+
+	struct __OperatorAbs
+	{
+		template <typename V> using result_t = V;
+
+		template <typename R>
+		static inline R apply(R x)
+		{
+			if constexpr (std::is_integral_v<R>)
+				return x < 0 ? R(__wrap_t<R>(0) - __wrap_t<R>(x)) : x;
+			else
+				return std::fabs(x);
+		}
+	};
+
+#pragma endregion
+
+#pragma region Kernels
+
+	template <typename Op, typename LoadA, typename LoadB>
+	static List* kernel_binary(LoadA load_a, LoadB load_b, u32 len)
+	{
+		// Kiểu bao quát : I32 + I64 -> I64, I64 + F32 -> F32 ...
+		using P = decltype(typename LoadA::value_type() + typename LoadB::value_type());
+		using C = typename Op::template compute_t<P>;
+		using R = typename Op::template result_t<P>;
+
+		auto result = new TypedArray<R>();
+		result->resize(len);
+
+		R* out = result->raw();
+		for (u32 i = 0u; i < len; ++i)
+			out[i] = Op::apply(C(load_a(i)), C(load_b(i)));
+
+		return result;
+	}
+
+	template <typename Op, typename Load>
+	static List* kernel_unary(Load load, u32 len)
+	{
+		using R = typename Op::template result_t<typename Load::value_type>;
+
+		auto result = new TypedArray<R>();
+		result->resize(len);
+
+		R* out = result->raw();
+		for (u32 i = 0u; i < len; ++i)
+			out[i] = Op::apply(R(load(i)));
+
+		return result;
+	}
+
+	template <typename Load, typename LoadBound>
+	static List* kernel_clip(Load load, LoadBound load_low, LoadBound load_high, u32 len)
+	{
+		using P = decltype(typename Load::value_type() + typename LoadBound::value_type());
+
+		auto result = new TypedArray<P>();
+		result->resize(len);
+
+		P low = P(load_low(0u)), high = P(load_high(0u));
+		P* out = result->raw();
+		for (u32 i = 0u; i < len; ++i)
+		{
+			P value = P(load(i));
+			out[i] = value < low ? low : (high < value ? high : value);
+		}
+
+		return result;
+	}
+
+#pragma endregion
+
+#pragma region Entry
+
+	template <typename Op>
+	static List* elementwise_binary(Object* a, Object* b, const char* block_location)
+	{
+		__ElementwiseOperand left, right;
+		operand_of(left, a, block_location);
+		operand_of(right, b, block_location);
+
+		if (left.is_sequence() == false && right.is_sequence() == false)
+			elementwise_error(block_location, "at least one operand must be a sequence");
+
+		if (left.is_sequence() && right.is_sequence() && left.sequence.len != right.sequence.len)
+			elementwise_error(block_location, "the two sequences must have the same size");
+
+		u32 len = left.is_sequence() ? left.sequence.len : right.sequence.len;
+
+		return operand_dispatch(left, [&](auto load_a)
+			{
+				return operand_dispatch(right, [&](auto load_b)
+					{
+						return kernel_binary<Op>(load_a, load_b, len);
+					});
+			});
+	}
+
+	template <typename Op>
+	static List* elementwise_unary(Object* a, const char* block_location)
+	{
+		__ElementwiseOperand operand;
+		operand_of(operand, a, block_location);
+
+		if (operand.is_sequence() == false)
+			elementwise_error(block_location, "operand must be a sequence");
+
+		return operand_dispatch(operand, [&](auto load)
+			{
+				return kernel_unary<Op>(load, operand.sequence.len);
+			});
+	}
+
+#pragma endregion
+
+#pragma region Definition : Elementwise
+
+	List* elementwise_add(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorAdd>(a, b, "elementwise_add");
+	}
+
+	List* elementwise_sub(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorSub>(a, b, "elementwise_sub");
+	}
+
+	List* elementwise_mul(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorMul>(a, b, "elementwise_mul");
+	}
+
+	List* elementwise_div(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorDiv>(a, b, "elementwise_div");
+	}
+
+
+	List* elementwise_equal(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorEqual>(a, b, "elementwise_equal");
+	}
+
+	List* elementwise_not_equal(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorNotEqual>(a, b, "elementwise_not_equal");
+	}
+
+	List* elementwise_less(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorLess>(a, b, "elementwise_less");
+	}
+
+	List* elementwise_less_equal(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorLessEqual>(a, b, "elementwise_less_equal");
+	}
+
+	List* elementwise_greater(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorGreater>(a, b, "elementwise_greater");
+	}
+
+	List* elementwise_greater_equal(Object* a, Object* b)
+	{
+		return elementwise_binary<__OperatorGreaterEqual>(a, b, "elementwise_greater_equal");
+	}
+
+
+	List* elementwise_sqrt(Object* a)
+	{
+		return elementwise_unary<__OperatorSqrt>(a, "elementwise_sqrt");
+	}
+
+	List* elementwise_exp(Object* a)
+	{
+		return elementwise_unary<__OperatorExp>(a, "elementwise_exp");
+	}
+
+	List* elementwise_log(Object* a)
+	{
+		return elementwise_unary<__OperatorLog>(a, "elementwise_log");
+	}
+
+	List* elementwise_abs(Object* a)
+	{
+		return elementwise_unary<__OperatorAbs>(a, "elementwise_abs");
+	}
+
+	List* elementwise_clip(Object* a, Object* low, Object* high)
+	{
+		const char* block_location = "elementwise_clip";
+
+		__ElementwiseOperand operand, operand_low, operand_high;
+		operand_of(operand, a, block_location);
+		operand_of(operand_low, low, block_location);
+		operand_of(operand_high, high, block_location);
+
+		if (operand.is_sequence() == false)
+			elementwise_error(block_location, "operand must be a sequence");
+
+		if (operand_low.is_sequence() || operand_high.is_sequence())
+			elementwise_error(block_location, "bounds must be numbers");
+
+		// Hai cận được đọc trên cùng kiểu ( kiểu bao quát của "low" và "high" )
+		auto bound = numeric_slot(low->type_index()) >= numeric_slot(high->type_index()) ? low : high;
+
+		return operand_dispatch(operand, [&](auto load)
+			{
+				return scalar_dispatch(bound, [&](auto load_bound)
+					{
+						using L = decltype(load_bound);
+						using B = typename L::value_type;
+
+						L load_low{ bound_value<B>(low) };
+						L load_high{ bound_value<B>(high) };
+
+						return kernel_clip(load, load_low, load_high, operand.sequence.len);
+					});
+			});
+	}
+
+#pragma endregion
+
+}
\ No newline at end of file
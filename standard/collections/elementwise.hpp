@@ -0,0 +1,56 @@
+#pragma once
+
+#include "reduce.hpp"
+
+namespace pycpp
+{
+
+#pragma region Declaration : Elementwise
+
+	/*
+	Elementwise : phép toán trên từng phần tử của dãy số, kết quả là TypedArray mới ( Object tạm ).
+
+	- Toán hạng : dãy số ( TypedArray, ArrayList, Tuple, Deque, Range ... ) hoặc một số Boolean, I32, I64, F32, F64.
+	  Số được lặp lại cho mọi phần tử ( broadcast ), cần ít nhất một toán hạng là dãy.
+	  Hai dãy phải cùng độ dài.
+	- Kiểu kết quả theo quy tắc của primitive.hpp : add / sub / mul cho ra kiểu bao quát nhất
+	  ( I32 + F32 -> F32 ... ), div cho ra số thực ( tối thiểu F32 ), Boolean được xem như I32.
+	- Dãy không đồng nhất ( trộn I32 với F64 ... ) được chuyển một lần sang TypedArray của kiểu bao quát nhất
+	  trong dãy, phần tử không phải số sẽ ném lỗi runtime.
+	- So sánh cho ra mặt nạ I32Array gồm 0 / 1 ( có thể dùng "sum" để đếm ).
+	- Vòng lặp đọc / ghi trực tiếp mảng giá trị, trình biên dịch có thể vector hóa.
+	- Toán hạng là Object tạm sẽ được giải phóng sau khi gọi.
+	*/
+
+	//==========     Arithmetic     ==========//
+
+	List* elementwise_add(Object* a, Object* b);
+	List* elementwise_sub(Object* a, Object* b);
+	List* elementwise_mul(Object* a, Object* b);
+	List* elementwise_div(Object* a, Object* b);
+
+	//==========     Comparison ( mặt nạ I32Array )     ==========//
+
+	List* elementwise_equal(Object* a, Object* b);
+	List* elementwise_not_equal(Object* a, Object* b);
+	List* elementwise_less(Object* a, Object* b);
+	List* elementwise_less_equal(Object* a, Object* b);
+	List* elementwise_greater(Object* a, Object* b);
+	List* elementwise_greater_equal(Object* a, Object* b);
+
+	//==========     Math     ==========//
+
+	// F32 giữ nguyên F32, các kiểu còn lại cho ra F64.
+	List* elementwise_sqrt(Object* a);
+	List* elementwise_exp(Object* a);
+	List* elementwise_log(Object* a);
+
+	// Giữ nguyên kiểu phần tử.
+	List* elementwise_abs(Object* a);
+
+	// Giới hạn mỗi phần tử trong [low, high] ( "low", "high" là số ), NaN giữ nguyên.
+	List* elementwise_clip(Object* a, Object* low, Object* high);
+
+#pragma endregion
+
+}
\ No newline at end of file
@@ -27,6 +27,11 @@ namespace pycpp
 		return HashTable::type_id;
 	}
 
+	Object* HashTable::as_object()
+	{
+		return this;
+	}
+
 	std::string HashTable::class_name()
 	{
 		return "HashTable";
@@ -60,6 +65,16 @@ namespace pycpp
 		return new HashTable(*this);
 	}
 
+	void HashTable::traverse(TraverseVisitor visit, void* context)
+	{
+		__HashTable::traverse(visit, context);
+	}
+
+	void HashTable::clear_references()
+	{
+		__HashTable::clear();
+	}
+
 	bool HashTable::equal(Object*)
 	{
 		// TODO
@@ -68,7 +83,7 @@ namespace pycpp
 
 	Object* HashTable::add(Object* other)
 	{
-		auto iterable = dynamic_cast<Iterable*>(other);
+		auto iterable = as_iterable(other);
 		if (iterable == nullptr)
 		{
 			char content_error[128];
@@ -102,6 +117,16 @@ namespace pycpp
 		return __HashTable::last();
 	}
 
+	bool HashTable::is_empty()
+	{
+		return len == 0u;
+	}
+
+	u32 HashTable::size()
+	{
+		return len;
+	}
+
 	#pragma endregion
 
 	#pragma region Override Container
@@ -138,6 +163,15 @@ namespace pycpp
 
 	#pragma endregion
 
+	#pragma region Steal Reference
+
+	bool HashTable::push_steal(Object* item)
+	{
+		return __HashTable::push_steal(item);
+	}
+
+	#pragma endregion
+
 	#pragma region Override Set
 
 	Object* HashTable::get(Object* elem)
@@ -147,6 +181,20 @@ namespace pycpp
 
 	#pragma endregion
 
+	#pragma region Hash Policy
+
+	void HashTable::set_hash_policy(HashPolicy policy)
+	{
+		__HashTable::set_hash_policy(policy);
+	}
+
+	HashPolicy HashTable::get_hash_policy()
+	{
+		return hash_policy;
+	}
+
+	#pragma endregion
+
 #pragma endregion
 
 }
\ No newline at end of file
@@ -10,8 +10,11 @@ namespace pycpp
 
 	class HashTable final : public Set, public __HashTable
 	{
+		// Được theo dõi bởi bộ thu gom chu trình.
+		__GCNode gc_node{ this };
+
 	public:
-		TYPE_ID(HashTable);
+		BUILTIN_TYPE_ID(HashTable);
 
 	#pragma region Constructors & Destructors
 
@@ -27,12 +30,15 @@ namespace pycpp
 	#pragma region Override Object
 
 		i64 type() override;
+		Object* as_object() override;
 		std::string class_name() override;
 		void output() override;
 		void output(std::string& out) override;
 		u32 bytes() override;
 		u64 hash() override;
 		Object* copy() override;
+		void traverse(TraverseVisitor visit, void* context) override;
+		void clear_references() override;
 
 		bool equal(Object*);
 
@@ -45,6 +51,9 @@ namespace pycpp
 		Iterator* first();
 		Iterator* last();
 
+		bool is_empty() override;
+		u32 size() override;
+
 	#pragma endregion
 
 	#pragma region Override Container
@@ -58,6 +67,14 @@ namespace pycpp
 
 	#pragma endregion
 
+	#pragma region Steal Reference
+
+		// Tương tự "push" nhưng nhận luôn tham chiếu của người gọi ( không INREF ) :
+		// set->push_steal(var.release()).
+		bool push_steal(Object*);
+
+	#pragma endregion
+
 	#pragma region Override Set
 
 		// Lấy ra phần tử trong HashTable.
@@ -67,6 +84,14 @@ namespace pycpp
 
 	#pragma endregion
 
+	#pragma region Hash Policy
+
+		// Đổi cách trộn hash ( xem HashPolicy ), băm lại toàn bộ phần tử.
+		void set_hash_policy(HashPolicy policy);
+		HashPolicy get_hash_policy();
+
+	#pragma endregion
+
 	};
 
 #pragma endregion
@@ -1,4 +1,10 @@
 #include "iterable.hpp"
+#include "arraylist.hpp"
+#include "tuple.hpp"
+#include "deque.hpp"
+#include "hashtable.hpp"
+#include "map.hpp"
+#include "view.hpp"
 #include "../base/algo.hpp"
 #include "../base/error.hpp"
 
@@ -12,14 +18,19 @@ namespace pycpp
 
 	void Iterator::prev()
 	{
-		// Note : mọi class đều phải kế thừa từ Object
-		auto object = dynamic_cast<Object*>(this)->class_name();
+		auto object = as_object()->class_name();
 		char block_location[32];
 		std::sprintf(block_location, "%s::prev", object.c_str());
 
 		__pycpp_error_dont_support_method(block_location);
 	}
 
+	Object* Iterator::as_object()
+	{
+		// Note : mọi class đều phải kế thừa từ Object
+		return dynamic_cast<Object*>(this);
+	}
+
 #pragma endregion
 
 #pragma region Definition : Iterable
@@ -155,6 +166,12 @@ namespace pycpp
 		return __len - __other_len;
 	}
 
+	Object* Arguments::as_object()
+	{
+		// Note : mọi class đều phải kế thừa từ Object
+		return dynamic_cast<Object*>(this);
+	}
+
 #pragma endregion
 
 #pragma region Definition : Container
@@ -176,4 +193,71 @@ namespace pycpp
 
 #pragma endregion
 
+#pragma region Definition : Casting
+
+	Arguments* as_arguments(Object* object)
+	{
+		switch (object->type_index())
+		{
+		case TypeIndex::ArrayList:
+		case TypeIndex::Deque:
+		case TypeIndex::FixedArray:
+		case TypeIndex::I32Array:
+		case TypeIndex::I64Array:
+		case TypeIndex::F32Array:
+		case TypeIndex::F64Array:
+			return static_cast<List*>(object);
+
+		case TypeIndex::Tuple:
+			return static_cast<Tuple*>(object);
+
+		case TypeIndex::View:
+			return static_cast<View*>(object);
+
+		case TypeIndex::OrderedMap:
+			return static_cast<OrderedMap*>(object);
+
+		case TypeIndex::Unknown:
+			return dynamic_cast<Arguments*>(object);
+
+		default:
+			return nullptr;
+		}
+	}
+
+	__Array* as_array(Object* object)
+	{
+		switch (object->type_index())
+		{
+		case TypeIndex::ArrayList:
+			return static_cast<ArrayList*>(object);
+
+		case TypeIndex::Tuple:
+			return static_cast<Tuple*>(object);
+
+		case TypeIndex::Unknown:
+			return dynamic_cast<__Array*>(object);
+
+		default:
+			return nullptr;
+		}
+	}
+
+	__HashTable* as_hashtable(Object* object)
+	{
+		switch (object->type_index())
+		{
+		case TypeIndex::HashTable:
+			return static_cast<HashTable*>(object);
+
+		case TypeIndex::Unknown:
+			return dynamic_cast<__HashTable*>(object);
+
+		default:
+			return nullptr;
+		}
+	}
+
+#pragma endregion
+
 }
\ No newline at end of file
@@ -34,6 +34,8 @@ namespace pycpp
 	|                                        | Cần gọi 'is_valid' trước để kiểm tra   |
 	|                                        | Iterator hợp lệ.                       |
 	+----------------------------------------+----------------------------------------+
+	| Object* as_object()                    | Trả về Object triển khai Iterator.     |
+	+----------------------------------------+----------------------------------------+
 
 	*/
 
@@ -66,6 +68,12 @@ namespace pycpp
 		/// </summary>
 		virtual Object* get() = 0;
 
+		/// <summary>
+		/// Trả về Object triển khai Iterator ( không tăng tham chiếu ).
+		/// Các lớp có sẵn ghi đè để tránh dynamic_cast.
+		/// </summary>
+		virtual Object* as_object();
+
 	};
 
 #pragma endregion
@@ -111,6 +119,9 @@ public:
 
 		virtual bool equal(Arguments*);
 		virtual i32 rich_compare(Arguments*);
+
+		// Trả về Object triển khai Arguments ( không tăng tham chiếu ).
+		virtual Object* as_object();
 	};
 
 #pragma endregion
@@ -316,4 +327,52 @@ public:
 
 #pragma endregion
 
+#pragma region Declaration : Casting
+
+	class __Array;
+	class __HashTable;
+
+	// Ép kiểu Object sang interface dựa trên TypeIndex ( thay cho dynamic_cast ).
+	// Trả về nullptr nếu "object" không triển khai interface.
+	// Lớp của người dùng ( TypeIndex::Unknown ) vẫn sử dụng dynamic_cast.
+
+	inline Iterable* as_iterable(Object* object)
+	{
+		if (object->has_capability(CAPABILITY_ITERABLE))
+			return static_cast<Iterable*>(object);
+		if (object->type_index() == TypeIndex::Unknown)
+			return dynamic_cast<Iterable*>(object);
+		return nullptr;
+	}
+
+	Arguments* as_arguments(Object* object);
+	__Array* as_array(Object* object);
+	__HashTable* as_hashtable(Object* object);
+
+	template <>
+	struct __ObjectCast<Iterable>
+	{
+		static inline Iterable* cast(Object* object) { return as_iterable(object); }
+	};
+
+	template <>
+	struct __ObjectCast<Arguments>
+	{
+		static inline Arguments* cast(Object* object) { return as_arguments(object); }
+	};
+
+	template <>
+	struct __ObjectCast<__Array>
+	{
+		static inline __Array* cast(Object* object) { return as_array(object); }
+	};
+
+	template <>
+	struct __ObjectCast<__HashTable>
+	{
+		static inline __HashTable* cast(Object* object) { return as_hashtable(object); }
+	};
+
+#pragma endregion
+
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "arraylist.hpp"
 #include "hashtable.hpp"
 
+#include <cstring>
+
 namespace pycpp
 {
 
@@ -13,11 +15,14 @@ namespace pycpp
 
 		#pragma region Constructors & Destructor
 
-	OrderedMap::OrderedMap() : ordered_entries(nullptr),
-		capacity(0u), len(0u), len_of_deleted(0u) {}
+	OrderedMap::OrderedMap() : ordered_entries(nullptr), indices(nullptr),
+		capacity(0u), len(0u), len_of_deleted(0u), growth_left(0u), live_tree(nullptr),
+		old_entries(nullptr), old_indices(nullptr), old_capacity(0u), migrate_index(0u), old_len_of_entries(0u),
+		hash_policy(PYCPP_HASH_POLICY) {}
 
 	OrderedMap::OrderedMap(OrderedMap& source) : OrderedMap()
 	{
+		hash_policy = source.hash_policy;
 		init_from_ordered_dictionary(&source);
 	}
 
@@ -33,14 +38,7 @@ namespace pycpp
 
 	OrderedMap::~OrderedMap()
 	{
-		if (len == 0u)
-			return;
-
-		u32 len_of_entries = len + len_of_deleted;
-		for (u32 i = 0u; i < len_of_entries; ++i)
-			if (ordered_entries[i].key != nullptr)
-				ordered_entries[i].clear();
-		delete ordered_entries;
+		allocation_release();
 	}
 
 		#pragma endregion
@@ -49,116 +47,205 @@ namespace pycpp
 
 	void OrderedMap::init_from_hashtable(__HashTable* source)
 	{
-		if (source->len)
+		if (source->len == 0u)
 		{
 			SAFE(source);
 			return;
 		}
 
-		allocation_resize_based_on_len(source->len);
+		allocation_resize_based_on_len(len + source->len);
 
-		// Adding all elements to "ordered_entries"
+		// Adding all elements, dùng lại hash đã lưu của "source"
+		source->finish_rehash();
 		for (u32 i = 0u; i < source->capacity; ++i)
-			for (auto head = source->data[i]; head; head = head->next)
-			{
-				// Gán vào "ordered_entries"
-				INREF(head->ref);
-				INREF(NONE);
-				ordered_entries[len] = { head->ref, NONE, head->hash_value };
-				++len;
-			}
-
-		// Restructuring "array_hash"
-		inline_restructure_entry_index();
+			if (source->is_full(i))
+				inline_push_pair({ source->data[i].ref, NONE, source->data[i].hash_value });
 
 		SAFE(source);
 	}
 
 	void OrderedMap::init_from_ordered_dictionary(OrderedMap* source)
 	{
-		if (source->len)
-		{
-			SAFE(source);
+		if (source->len == 0u)
 			return;
-		}
 
-		// Sao chép những gì "source" có.
-		capacity = source->capacity;
-		len = source->len;
-		len_of_deleted = source->len_of_deleted;
+		// Các "key" của "source" không trùng nhau : không cần so sánh
+		source->allocation_finish_migrate();
+		allocation_resize_capacity(inline_find_capacity(source->len));
 
-		ordered_entries = new EntryPair[capacity];
-		for (u32 i = 0u; i < capacity; ++i)
+		u32 len_of_source_entries = source->len + source->len_of_deleted;
+		for (u32 i = 0u; i < len_of_source_entries; ++i)
 		{
-			ordered_entries[i] = source->ordered_entries[i];
-			INREF(ordered_entries[i].key);
-			INREF(ordered_entries[i].value);
-		}
+			auto& entry_pair = source->ordered_entries[i];
+			if (entry_pair.key == nullptr)
+				continue;
 
-		SAFE(source);
+			INREF(entry_pair.key);
+			INREF(entry_pair.value);
+			inline_insert(inline_find_empty_slot(entry_pair.hash_value),
+				entry_pair.key, entry_pair.value, entry_pair.hash_value);
+		}
 	}
 
 		#pragma endregion
 
 		#pragma region Allocation
 
-	void OrderedMap::allocation_grow()
+	void OrderedMap::allocation_release()
 	{
-		if (capacity == 0u)
+		if (ordered_entries == nullptr)
+			return;
+
+		// Tách bảng trước khi giải phóng phần tử
+		auto entries = ordered_entries;
+		auto migrating_entries = old_entries;
+		auto len_of_entries = len + len_of_deleted;
+		auto begin_of_migrating = migrate_index;
+		auto end_of_migrating = old_len_of_entries;
+
+		delete[] static_cast<u8*>(indices);
+		delete[] static_cast<u8*>(old_indices);
+		delete[] live_tree;
+		ordered_entries = old_entries = nullptr;
+		indices = old_indices = nullptr;
+		live_tree = nullptr;
+		capacity = len = len_of_deleted = growth_left = 0u;
+		old_capacity = migrate_index = old_len_of_entries = 0u;
+
+		for (u32 i = 0u; i < len_of_entries; ++i)
 		{
-			allocation_grow_when_empty();
+			if (migrating_entries != nullptr && i >= begin_of_migrating && i < end_of_migrating)
+				migrating_entries[i].clear();
+			else
+				entries[i].clear();
+		}
+
+		delete[] entries;
+		delete[] migrating_entries;
+	}
+
+	void OrderedMap::allocation_grow()
+	{
+		allocation_finish_migrate();
+
+		// Nhiều phần tử đã xóa : chỉ dồn phần tử, dung lượng có thể giữ nguyên
+		auto n_capacity = inline_find_capacity(len << 1u);
+		if (n_capacity > capacity && n_capacity >= PYCPP_INCREMENTAL_REHASH_CAPACITY)
+			allocation_begin_migrate(n_capacity);
+		else
+			allocation_resize_capacity(n_capacity);
+	}
+
+	void OrderedMap::allocation_begin_migrate(u32 n_capacity)
+	{
+		old_entries = ordered_entries;
+		old_indices = indices;
+		old_capacity = capacity;
+		migrate_index = 0u;
+		old_len_of_entries = len + len_of_deleted;
+
+		capacity = n_capacity;
+		ordered_entries = new EntryPair[inline_usable(capacity)];
+
+		auto indices_bytes = capacity * inline_index_width(capacity);
+		indices = new u8[indices_bytes];
+		std::memset(indices, 0xFF, indices_bytes);
+
+		// Vị trí phần tử không đổi : phần tử bị xóa vẫn chiếm chỗ
+		growth_left = inline_usable(capacity) - old_len_of_entries;
+
+		delete[] live_tree;
+		live_tree = nullptr;
+
+		allocation_migrate(PYCPP_REHASH_STEP);
+	}
+
+	void OrderedMap::allocation_migrate(u32 budget)
+	{
+		if (old_entries == nullptr)
 			return;
+
+		u32 end = old_len_of_entries - migrate_index > budget ? migrate_index + budget : old_len_of_entries;
+		for (; migrate_index < end; ++migrate_index)
+		{
+			auto& entry_pair = old_entries[migrate_index];
+			ordered_entries[migrate_index] = entry_pair;
+			if (entry_pair.key != nullptr)
+				inline_set_index(inline_find_empty_slot(entry_pair.hash_value), i32(migrate_index));
+		}
+
+		if (migrate_index == old_len_of_entries)
+		{
+			delete[] old_entries;
+			delete[] static_cast<u8*>(old_indices);
+			old_entries = nullptr;
+			old_indices = nullptr;
+			old_capacity = migrate_index = old_len_of_entries = 0u;
 		}
+	}
 
-		allocation_resize_capacity(capacity << 1u | 1u);
+	void OrderedMap::allocation_finish_migrate()
+	{
+		if (old_entries != nullptr)
+			allocation_migrate(old_len_of_entries);
 	}
 
 	void OrderedMap::allocation_shrink()
 	{
-		if (capacity == 3u)
-		{
-			allocation_shrink_to_emptry();
+		if (capacity <= MIN_CAPACITY || len >= (inline_usable(capacity) >> 3u))
 			return;
-		}
 
-		allocation_resize_capacity(capacity >> 1u);
+		auto n_capacity = inline_find_capacity(len << 1u);
+		if (n_capacity < capacity)
+			allocation_resize_capacity(n_capacity);
 	}
 
 	void OrderedMap::allocation_resize_based_on_len(u32 n_len)
 	{
-		auto n_capacity = inline_find_capacity(n_len);
-		allocation_resize_capacity(n_capacity);
+		if (n_len <= len || n_len - len <= growth_left)
+			return;
+
+		allocation_resize_capacity(inline_find_capacity(n_len));
 	}
 
 	void OrderedMap::allocation_resize_capacity(u32 n_capacity)
 	{
-		if (capacity = 0u)
-		{
-			capacity = n_capacity;
-			ordered_entries = new EntryPair[capacity];
-			inline_fill_entry_index();
-			return;
-		}
+		allocation_finish_migrate();
+
+		auto entries = ordered_entries;
+		auto entries_indices = indices;
+		auto len_of_entries = len + len_of_deleted;
 
-		// Grow "ordered_entries"
 		capacity = n_capacity;
-		auto ordered_entries_tmp = ordered_entries;
-		ordered_entries = new EntryPair[capacity];
+		ordered_entries = new EntryPair[inline_usable(capacity)];
+
+		// INDEX_EMPTY ( -1 ) : mọi byte là 0xFF với mọi độ rộng
+		auto indices_bytes = capacity * inline_index_width(capacity);
+		indices = new u8[indices_bytes];
+		std::memset(indices, 0xFF, indices_bytes);
 
-		// Move "ordered_entries"
-		if (len_of_deleted = 0u)
+		// Dồn phần tử và băm lại ( không thay đổi tham chiếu )
+		u32 counter = 0u;
+		for (u32 i = 0u; i < len_of_entries; ++i)
 		{
-			for (u32 i = 0u; i < len; ++i)
-				ordered_entries[i] = ordered_entries_tmp[i];
+			auto& entry_pair = entries[i];
+			if (entry_pair.key == nullptr)
+				continue;
+
+			ordered_entries[counter] = entry_pair;
+			inline_set_index(inline_find_empty_slot(entry_pair.hash_value), i32(counter));
+			++counter;
 		}
-		else
-			inline_restructured_ordered_entries(ordered_entries_tmp);
 
-		delete[] ordered_entries_tmp;
+		len_of_deleted = 0u;
+		growth_left = inline_usable(capacity) - len;
+
+		// Không còn phần tử bị xóa : truy cập theo vị trí trực tiếp
+		delete[] live_tree;
+		live_tree = nullptr;
 
-		// Grow "array_hash"
-		inline_fill_entry_index();
-		inline_restructure_entry_index();
+		delete[] entries;
+		delete[] static_cast<u8*>(entries_indices);
 	}
 
 	void OrderedMap::allocation_restructure()
@@ -166,12 +253,35 @@ namespace pycpp
 		if (len_of_deleted == 0u)
 			return;
 
-		// Xử lý "ordered_entries"
-		inline_restructured_ordered_entries(ordered_entries);
+		allocation_resize_capacity(capacity);
+	}
+
+	void OrderedMap::allocation_prepare_freeze()
+	{
+		allocation_finish_migrate();
+
+		// Dồn phần tử : truy cập theo vị trí không cần tạo "live_tree"
+		allocation_restructure();
+	}
+
+	void OrderedMap::allocation_build_live_tree()
+	{
+		allocation_finish_migrate();
+
+		u32 tree_size = inline_usable(capacity);
+		u32 len_of_entries = len + len_of_deleted;
 
-		// Xử lý bảng băm
-		inline_fill_entry_index();
-		inline_restructure_entry_index();
+		live_tree = new u32[tree_size + 1u]();
+		for (u32 i = 1u; i <= len_of_entries; ++i)
+			live_tree[i] = ordered_entries[i - 1u].key != nullptr ? 1u : 0u;
+
+		// Cộng dồn lên nút cha, O(n)
+		for (u32 i = 1u; i <= tree_size; ++i)
+		{
+			u32 parent = i + (i & (0u - i));
+			if (parent <= tree_size)
+				live_tree[parent] += live_tree[i];
+		}
 	}
 
 		#pragma endregion
@@ -205,9 +315,10 @@ namespace pycpp
 		}
 
 		// Adding all elements
+		source->finish_rehash();
 		for (u32 i = 0u; i < source->capacity; ++i)
-			for(auto head = source->data[i]; head; head = head->next)
-				inline_push_pair({ head->ref, NONE, head->hash_value });
+			if (source->is_full(i))
+				inline_push_pair({ source->data[i].ref, NONE, source->data[i].hash_value });
 
 		SAFE(source);
 	}
@@ -236,6 +347,7 @@ namespace pycpp
 		}
 
 		// Adding all elements
+		source->allocation_finish_migrate();
 		u32 len_of_source_entries = source->len + source->len_of_deleted;
 		for (u32 i = 0u; i < len_of_source_entries; ++i)
 		{
@@ -259,6 +371,45 @@ namespace pycpp
 
 		#pragma endregion
 
+		#pragma region Override Object
+
+	i64 OrderedMap::type()
+	{
+		return OrderedMap::type_id;
+	}
+
+	Object* OrderedMap::as_object()
+	{
+		return this;
+	}
+
+	std::string OrderedMap::class_name()
+	{
+		return "OrderedMap";
+	}
+
+	void OrderedMap::traverse(TraverseVisitor visit, void* context)
+	{
+		// Không chuyển phần tử : bộ thu gom chỉ đọc
+		u32 number_of_entries = len + len_of_deleted;
+		for (u32 i = 0u; i < number_of_entries; ++i)
+		{
+			auto& entry_pair = inline_entry(i);
+			if (entry_pair.key == nullptr)
+				continue;
+
+			visit(entry_pair.key, context);
+			visit(entry_pair.value, context);
+		}
+	}
+
+	void OrderedMap::clear_references()
+	{
+		clear();
+	}
+
+		#pragma endregion
+
 		#pragma region Override Arguments
 
 	bool OrderedMap::is_empty()
@@ -279,17 +430,7 @@ namespace pycpp
 		if (index < 0)
 			index += i32(len);
 
-		if (len_of_deleted == 0u)
-			return ordered_entries[index].get_pair();
-
-		// Tìm vị trí Entry với "index".
-		i32 index_of_entry;
-		if (index < (len >> 1))
-			index_of_entry = inline_find_from_left(index);
-		else
-			index_of_entry = inline_find_from_right(i32(len) - index - 1);
-
-		return ordered_entries[index_of_entry].get_pair();
+		return inline_entry(u32(inline_find_entry(u32(index)))).get_pair();
 	}
 
 		#pragma endregion
@@ -298,13 +439,14 @@ namespace pycpp
 
 	Iterator* OrderedMap::first()
 	{
-		auto first_index = inline_find_from_left(0);
+		auto first_index = len == 0u ? -1 : inline_find_entry(0u);
 		return new OrderedMap::iterator(this, first_index);
 	}
 
 	Iterator* OrderedMap::last()
 	{
-		auto last_index = inline_find_from_right(0);
+		// Phần tử cuối cùng luôn còn "key"
+		auto last_index = len == 0u ? -1 : i32(len + len_of_deleted) - 1;
 		return new OrderedMap::iterator(this, last_index);
 	}
 
@@ -314,29 +456,24 @@ namespace pycpp
 
 	void OrderedMap::clear()
 	{
-		if (len == 0u)
-			return;
+		inline_check_frozen("OrderedMap::clear");
 
-		auto len_of_entries = len + len_of_deleted;
-		for (u32 i = 0u; i < len_of_entries; ++i)
-			if (ordered_entries[i].key)
-				ordered_entries[i].clear();
-		delete ordered_entries;
-
-		ordered_entries = nullptr;
-		capacity = len = len_of_deleted = 0u;
+		allocation_release();
 	}
 
 	bool OrderedMap::contains(Object* element)
 	{
-		bool result = inline_find_entry_index(element, element->hash());
+		u32 slot;
+		bool result = inline_lookup(element, element->hash(), slot) != -1;
 		SAFE(element);
-		return result < 0;
+		return result;
 	}
 
 
 	bool OrderedMap::push(Object* item)
 	{
+		inline_check_frozen("OrderedMap::push");
+
 		auto result = inline_push_pair({ item, NONE });
 
 		if(result == false)
@@ -346,51 +483,56 @@ namespace pycpp
 
 	Object* OrderedMap::pop()
 	{
+		inline_check_frozen("OrderedMap::pop");
+
 		// Error : retrieve from empty OrderedMap
 		if (len == 0u)
 			__pycpp_error_retrieve_from_empty_container("OrderedMap::pop", "OrderedMap");
 
-		// Tìm vị trí Entry cuối cùng ( không bị đánh dấu )
-		i32 index = len + len_of_deleted - 1u;
-		if (len_of_deleted != 0u)
-			for (; ordered_entries[index].key == nullptr; --index);
+		allocation_migrate(PYCPP_REHASH_STEP);
 
-		auto result = ordered_entries[index].get_pair();
-		ordered_entries[index].clear();
+		// Phần tử cuối cùng luôn còn "key"
+		i32 index = i32(len + len_of_deleted) - 1;
+		auto result = inline_entry(u32(index)).get_pair();
 
-		// Đánh dấu "đã xóa" tại "entry_index"
-		ordered_entries[ordered_entries[index].mapping].entry_index = -1;
+		auto entry_pair = inline_detach(inline_find_slot_of(index), index);
+		allocation_shrink();
 
+		entry_pair.clear();
 		return result;
 	}
 
 	void OrderedMap::extend(std::initializer_list<Object*> list)
 	{
-		u32 list_len = list.size();
-		auto iter = list.begin();
+		inline_check_frozen("OrderedMap::extend");
+
+		allocation_resize_based_on_len(len + u32(list.size()));
 
-		for (u32 i = 0u; i < list_len; ++i)
-			inline_push_pair({ iter[i], NONE });
+		for (auto item : list)
+			inline_push_pair({ item, NONE });
 	}
 
 	void OrderedMap::extend(Iterable* iterable)
 	{
+		inline_check_frozen("OrderedMap::extend");
+
 		switch (iterable->type())
 		{
 		case Tuple::type_id:
 		case ArrayList::type_id:
-			private_extend_from_array(dynamic_cast<__Array*>(iterable));
+			private_extend_from_array(as_array(iterable));
 			break;
 
 		case HashTable::type_id:
-			private_extend_from_hashtable(dynamic_cast<__HashTable*>(iterable));
+			private_extend_from_hashtable(as_hashtable(iterable));
 			break;
 
 		case OrderedMap::type_id:
-			private_extend_from_ordered_dictionary(dynamic_cast<OrderedMap*>(iterable));
+			private_extend_from_ordered_dictionary(static_cast<OrderedMap*>(iterable));
+			break;
 
 		case Deque::type_id:
-			private_extend_from_deque(dynamic_cast<Deque*>(iterable));
+			private_extend_from_deque(static_cast<Deque*>(iterable));
 			break;
 
 		default:
@@ -404,7 +546,8 @@ namespace pycpp
 
 	Object* OrderedMap::get(Object* key)
 	{
-		auto entry_index = inline_find_entry_index(key, key->hash());
+		u32 slot;
+		auto entry_index = inline_lookup(key, key->hash(), slot);
 
 		// Error : "key" doesn't exist
 		if (entry_index < 0)
@@ -415,9 +558,9 @@ namespace pycpp
 			throw std::exception("Error : get \"value\" with \"key\" doesn't exist in Dictionary");
 		}
 
-		auto mapping = ordered_entries[entry_index].entry_index;
-		auto& entry_pair = ordered_entries[mapping];
-		return entry_pair.value;
+		auto result = inline_entry(u32(entry_index)).value;
+		SAFE(key);
+		return result;
 	}
 
 		#pragma endregion
@@ -426,116 +569,141 @@ namespace pycpp
 
 	void OrderedMap::set(Object* key, Object* value)
 	{
-		if (len == 0u)
-			allocation_grow_when_empty();
+		inline_check_frozen("OrderedMap::set");
 
-		auto key_hash = key->hash();
+		INREF(key);
+		INREF(value);
+		set_steal(key, value);
+	}
 
-		u32 index;
-		i32 mapping;
-		i32 entry_index_is_deleted = -1;
-		for (u32 i = 1u;; ++i)
+	void OrderedMap::set_steal(Object* key, Object* value)
+	{
+		if (is_frozen())
 		{
-			index = inline_probing(key_hash, i);
-			mapping = ordered_entries[index].entry_index;
-
-			// "key" doesn't exist
-			if (mapping == INT32_MAX)
-			{
-				if (entry_index_is_deleted != -1)
-					index = entry_index_is_deleted;
-				break;
-			}
-
-			if (mapping < 0)	// Bị đánh dấu "deleted"
-			{
-				entry_index_is_deleted = index;
-				continue;
-			}
+			DECREF(key);
+			DECREF(value);
+			inline_check_frozen("OrderedMap::set");
+		}
 
-			// Kiểm tra giá trị băm
-			if (key_hash != ordered_entries[mapping].hash_value)
-				continue;
+		auto key_hash = key->hash();
 
-			// So sánh "equal"
-			if (key->equal(ordered_entries[mapping].key))
-				break;
-		}
+		u32 slot;
+		auto entry_index = inline_lookup(key, key_hash, slot);
 
 		// Thêm mới "key-value"
-		if (mapping == INT32_MAX)
+		if (entry_index == -1)
 		{
-			auto last_entry_index = len + len_of_deleted;
-			ordered_entries[last_entry_index] = { key, value, key_hash, 0u, index };
-			ordered_entries[index].entry_index = last_entry_index;
-			++len;
-			INREF(key);
-			INREF(value);
-
-			if (len >= (capacity >> 1))
+			if (growth_left == 0u)
+			{
 				allocation_grow();
+				slot = inline_find_empty_slot(key_hash);
+			}
+
+			inline_insert(slot, key, value, key_hash);
 			return;
 		}
 
 		// Chèn "value" mới vào "key" có sẵn
-		auto& entry_pair = ordered_entries[index];
-		DEREF(entry_pair.value);
-		SAFE(entry_pair.value);
-
+		auto& entry_pair = inline_entry(u32(entry_index));
+		auto old_value = entry_pair.value;
 		entry_pair.value = value;
-		INREF(value);
+		DECREF(old_value);
 
-		SAFE(key);
+		// "key" đã tồn tại, trả lại tham chiếu
+		DECREF(key);
 	}
 
 	Object* OrderedMap::pop(Object* key)
 	{
-		auto entry_index = inline_find_entry_index(key, key->hash());
+		inline_check_frozen("OrderedMap::pop(Object key)");
+
+		u32 slot;
+		auto entry_index = inline_lookup(key, key->hash(), slot);
 
 		// Not exist
 		if (entry_index < 0)
 			__pycpp_error_retrieve_from_empty_container("OrderedMap::pop(Object key)",
 				"OrderedMap");
 
-		auto& mapping = ordered_entries[entry_index].entry_index;
-		auto& entry_pair = ordered_entries[mapping];
+		auto result = inline_entry(u32(entry_index)).get_pair();
 
-		auto result = entry_pair.get_pair();
-		entry_pair.clear();
-
-		// Đánh dấu "đã xóa"
-		mapping = -1;
-		++len_of_deleted;
-		--len;
+		// "key" có thể là chính Object trong Map : giải phóng trước khi Map bỏ tham chiếu
+		SAFE(key);
 
-		if (len < (capacity >> 2))
-			allocation_shrink();
+		auto entry_pair = inline_detach(slot, entry_index);
+		allocation_shrink();
 
-		SAFE(key);
+		entry_pair.clear();
 		return result;
 	}
 
 	void OrderedMap::remove(Object* key)
 	{
-		auto entry_index = inline_find_entry_index(key, key->hash());
+		inline_check_frozen("OrderedMap::remove");
+
+		u32 slot;
+		auto entry_index = inline_lookup(key, key->hash(), slot);
+		SAFE(key);
 
 		// Not exist
 		if (entry_index < 0)
 			return;
 
-		auto& mapping = ordered_entries[entry_index].entry_index;
-		auto& entry_pair = ordered_entries[mapping];
+		auto entry_pair = inline_detach(slot, entry_index);
+		allocation_shrink();
+
 		entry_pair.clear();
+	}
+
+	Iterable* OrderedMap::keys()
+	{
+		auto result = new ArrayList();
+		u32 len_of_entries = len + len_of_deleted;
+		for (u32 i = 0u; i < len_of_entries; ++i)
+			if (inline_entry(i).key != nullptr)
+				result->push(inline_entry(i).key);
+		return result;
+	}
+
+	Iterable* OrderedMap::values()
+	{
+		auto result = new ArrayList();
+		u32 len_of_entries = len + len_of_deleted;
+		for (u32 i = 0u; i < len_of_entries; ++i)
+			if (inline_entry(i).key != nullptr)
+				result->push(inline_entry(i).value);
+		return result;
+	}
+
+	Iterable* OrderedMap::items()
+	{
+		auto result = new ArrayList();
+		u32 len_of_entries = len + len_of_deleted;
+		for (u32 i = 0u; i < len_of_entries; ++i)
+			if (inline_entry(i).key != nullptr)
+				result->push(inline_entry(i).get_pair());
+		return result;
+	}
 
-		// Đánh dấu "đã xóa"
-		mapping = -1;
-		++len_of_deleted;
-		--len;
+		#pragma endregion
 
-		if (len < (capacity >> 2))
-			allocation_shrink();
+		#pragma region Hash Policy
 
-		SAFE(key);
+	void OrderedMap::set_hash_policy(HashPolicy policy)
+	{
+		if (policy == hash_policy)
+			return;
+
+		// "indices" được dựng lại với cách trộn mới
+		allocation_finish_migrate();
+		hash_policy = policy;
+		if (capacity != 0u)
+			allocation_resize_capacity(capacity);
+	}
+
+	HashPolicy OrderedMap::get_hash_policy()
+	{
+		return hash_policy;
 	}
 
 		#pragma endregion
@@ -552,8 +720,7 @@ namespace pycpp
 
 	OrderedMap::iterator::~iterator()
 	{
-		DEREF(container);
-		SAFE(container);
+		DECREF(container);
 	}
 
 
@@ -562,6 +729,11 @@ namespace pycpp
 		return OrderedMap::iterator::type_id;
 	}
 
+	Object* OrderedMap::iterator::as_object()
+	{
+		return this;
+	}
+
 	std::string OrderedMap::iterator::class_name()
 	{
 		return "OrderedMap::iterator";
@@ -575,18 +747,21 @@ namespace pycpp
 
 	bool OrderedMap::iterator::is_valid()
 	{
-		return index_of_entry != -1 || 
-			index_of_entry != container->len + container->len_of_deleted;
+		return index_of_entry != -1;
 	}
 
 	void OrderedMap::iterator::next()
 	{
-		auto len_of_entries = container->len + container->len_of_deleted;
-		if (index_of_entry == len_of_entries)
+		if (index_of_entry == -1)
 			__pycpp_error_out_of_bound("OrderedMap::iterator::next()");
 
-		while (index_of_entry < len_of_entries ||
-			container->ordered_entries[++index_of_entry].key == nullptr);
+		i32 len_of_entries = i32(container->len + container->len_of_deleted);
+		do
+			++index_of_entry;
+		while (index_of_entry < len_of_entries && container->inline_entry(u32(index_of_entry)).key == nullptr);
+
+		if (index_of_entry >= len_of_entries)
+			index_of_entry = -1;
 	}
 
 	void OrderedMap::iterator::prev()
@@ -594,8 +769,9 @@ namespace pycpp
 		if (index_of_entry == -1)
 			__pycpp_error_out_of_bound("OrderedMap::iterator::prev()");
 
-		while (index_of_entry >= 0 ||
-			container->ordered_entries[--index_of_entry].key == nullptr);
+		do
+			--index_of_entry;
+		while (index_of_entry >= 0 && container->inline_entry(u32(index_of_entry)).key == nullptr);
 	}
 
 	Object* OrderedMap::iterator::get()
@@ -603,7 +779,7 @@ namespace pycpp
 		if (is_valid() == false)
 			__pycpp_error_out_of_bound("OrderedMap::iterator::get()");
 
-		return container->ordered_entries[index_of_entry].get_pair();
+		return container->inline_entry(u32(index_of_entry)).get_pair();
 	}
 
 
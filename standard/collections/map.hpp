@@ -1,5 +1,8 @@
 #pragma once
 
+#include "../base/algo.hpp"
+#include "../base/allocator.hpp"
+#include "../base/collector.hpp"
 #include "iterable.hpp"
 #include "array.hpp"
 #include "private_hashtable.hpp"
@@ -22,22 +25,14 @@ namespace pycpp
 		Object* key;
 		Object* value;
 		u64 hash_value;
-		i32 entry_index;
-		i32 mapping;
 
 		inline EntryPair() = default;
 
 		inline EntryPair(Object* key, Object* value) :
-			key(key), value(value), hash_value(key->hash()), entry_index(0u), mapping(0u) {}
+			key(key), value(value), hash_value(key->hash()) {}
 
 		inline EntryPair(Object* key, Object* value, u64 hash_of_key) :
-			key(key), value(value), hash_value(hash_of_key),
-			entry_index(0u), mapping(0u) {}
-
-		inline EntryPair(Object* key, Object* value, u64 hash_of_key,
-			i32 entry_index, i32 mapping) :
-			key(key), value(value), hash_value(hash_of_key),
-			entry_index(entry_index), mapping(mapping) {}
+			key(key), value(value), hash_value(hash_of_key) {}
 
 		// Gán và tăng tham chiếu.
 		inline void set(Object* key, Object* value)
@@ -58,47 +53,88 @@ namespace pycpp
 			if (key == nullptr)
 				return;
 			
-			DEREF(key);
-			SAFE(key);
-			DEREF(value);
-			SAFE(value);
+			DECREF(key);
+			DECREF(value);
 
 			key = nullptr;
 			value = nullptr;
 		}
 
-		inline void operator=(const EntryPair& source)
-		{
-			key = source.key;
-			value = source.value;
-			mapping = source.mapping;
-		}
-
 	};
 
 #pragma endregion
 
 #pragma region Declaration : Map
 
+	/*
+	OrderedMap : từ điển gọn ( compact dict ) giữ thứ tự thêm vào.
+
+	- "ordered_entries" : mảng EntryPair dày đặc theo thứ tự thêm vào, phần tử bị xóa có "key" là nullptr.
+	- "indices" : bảng băm thưa, mỗi ô là vị trí trong "ordered_entries", INDEX_EMPTY hoặc INDEX_DUMMY ( đã xóa ).
+	  Độ rộng mỗi ô là i8 / i16 / i32 tùy theo "capacity", nên bảng băm của Map nhỏ chỉ tốn vài byte.
+	- "ordered_entries" chỉ có 2/3 "capacity" phần tử, bảng băm luôn còn ô trống.
+	- Dò bằng nhiễu loạn ( perturbation ) : mọi bit của hash lần lượt tham gia vào vị trí dò.
+	  Hash được trộn theo "hash_policy" trước khi dò, "ordered_entries" lưu hash gốc.
+	- Truy cập theo vị trí khi có phần tử bị xóa : cây Fenwick "live_tree" đếm phần tử còn "key",
+	  chỉ được tạo ở lần truy cập đầu tiên và bị bỏ khi dồn phần tử ( cấp phát lại ).
+	- Tăng trưởng tăng dần ( bảng mới từ PYCPP_INCREMENTAL_REHASH_CAPACITY ô ) : giữ nguyên vị trí phần tử,
+	  mỗi lần thay đổi / tìm kiếm chuyển PYCPP_REHASH_STEP phần tử từ "old_entries" sang bảng mới.
+	  Dồn phần tử và giảm dung lượng ( dưới 1/8 ) vẫn thực hiện một lần.
+	- "freeze" hoàn tất tăng trưởng tăng dần và dồn phần tử trước khi đánh dấu :
+	  OrderedMap đã freeze không ghi khi tìm kiếm hay truy cập theo vị trí.
+	*/
 	class OrderedMap final : public Dictionary, public Arguments
 	{
 		friend Pair;
 		friend __Array;
 		friend __HashTable;
 		friend Deque;
+		friend void freeze(Object* object);
 
 	#pragma region Map
 
+		static constexpr const i32 INDEX_EMPTY = -1;
+		static constexpr const i32 INDEX_DUMMY = -2;
+		static constexpr const u32 MIN_CAPACITY = 8u;
+		static constexpr const u32 PERTURB_SHIFT = 5u;
+
 		EntryPair* ordered_entries;
+		void* indices;
+
+		// Số ô của "indices" ( lũy thừa của 2 ).
 		u32 capacity;
 		u32 len;
+
+		// Số phần tử bị xóa nằm giữa "ordered_entries" ( phần tử bị xóa ở cuối được bỏ luôn ).
 		u32 len_of_deleted;
 
+		// Số phần tử còn có thể thêm trước khi cấp phát lại, không tăng khi xóa.
+		u32 growth_left;
+
+		// Cây Fenwick ( bắt đầu từ 1 ) trên "ordered_entries" : 1 nếu phần tử còn "key", 0 nếu đã xóa.
+		// nullptr : chưa tạo ( không tạo trong lúc tăng trưởng tăng dần ).
+		u32* live_tree;
+
+		// Bảng cũ trong lúc tăng trưởng tăng dần, nullptr nếu không tăng trưởng.
+		// Phần tử [migrate_index, old_len_of_entries) nằm trong "old_entries" ( ô băm trong "old_indices" ),
+		// các phần tử còn lại nằm trong "ordered_entries".
+		EntryPair* old_entries;
+		void* old_indices;
+		u32 old_capacity;
+		u32 migrate_index;
+		u32 old_len_of_entries;
+
+		// Cách trộn hash trước khi dò ( mặc định PYCPP_HASH_POLICY ).
+		HashPolicy hash_policy;
+
+		// Được theo dõi bởi bộ thu gom chu trình.
+		__GCNode gc_node{ this };
+
 	public:
 		class iterator;
 		friend iterator;
 
-		TYPE_ID(Map);
+		BUILTIN_TYPE_ID(OrderedMap);
 
 		#pragma region Constructors & Destructor
 
@@ -113,169 +149,274 @@ namespace pycpp
 
 		#pragma region Inline Funtion
 
-		inline u32 inline_find_capacity(u32 n_len)
+		// Số phần tử của "ordered_entries" ứng với "n_capacity" ô băm.
+		static inline u32 inline_usable(u32 n_capacity)
 		{
-			auto power_of_2 = pycpp::find_next_power_of_two(n_len);
-			return (power_of_2 << 1u) - 1u;
+			return (n_capacity << 1u) / 3u;
 		}
 
-		inline u32 inline_probing(u64 hash_value, u32 number)
+		// Độ rộng ( byte ) một ô của "indices".
+		static inline u32 inline_index_width(u32 n_capacity)
 		{
-			u32 squared = number * number;
-			u64 probing_value = hash_value + (squared ^ number) + (squared ^ hash_value);
-			return (probing_value & capacity) - 1u;
+			if (n_capacity <= 0x80u)
+				return 1u;
+			if (n_capacity <= 0x8000u)
+				return 2u;
+			return 4u;
 		}
 
-		inline void inline_fill_entry_index()
+		// Dung lượng nhỏ nhất đủ chứa "n_len" phần tử.
+		inline u32 inline_find_capacity(u32 n_len)
 		{
-			for (u32 i = 0u; i < capacity; ++i)
-				ordered_entries[i].entry_index = INT32_MAX;
+			u32 n_capacity = MIN_CAPACITY;
+			while (inline_usable(n_capacity) < n_len)
+				n_capacity <<= 1u;
+			return n_capacity;
 		}
 
-		// Kiểm tra xem số lượng "phần tử bị đánh dấu là xóa" có nhiều đến mức cần cấu trúc lại không.
-		//Trả về True nếu "len + len_of_deleted > 2/3 capacity".
-		inline bool inline_is_needed_restructure()
+		static inline i32 inline_get_index(void* table, u32 table_capacity, u32 slot)
 		{
-			return (len + len_of_deleted) > ((capacity << 1u) / 3u);
+			switch (inline_index_width(table_capacity))
+			{
+			case 1u:
+				return static_cast<i8*>(table)[slot];
+			case 2u:
+				return static_cast<i16*>(table)[slot];
+			default:
+				return static_cast<i32*>(table)[slot];
+			}
 		}
 
-		// Tái cấu trúc "ordered_entries", xóa bỏ "len_of_deleted".
-		// Chỉ gọi khi "len_of_deleted" khác 0.
-		inline void inline_restructured_ordered_entries(EntryPair* old_entries)
+		static inline void inline_set_index(void* table, u32 table_capacity, u32 slot, i32 entry_index)
 		{
-			u32 counter = 0u;
-			auto len_of_entries = len + len_of_deleted;
-			for (u32 i = 0u; i < len_of_entries; ++i)
+			switch (inline_index_width(table_capacity))
 			{
-				if (old_entries[i].key == nullptr)
-				{
-					++counter;
-					continue;
-				}
-
-				ordered_entries[i - counter] = old_entries[i];
+			case 1u:
+				static_cast<i8*>(table)[slot] = i8(entry_index);
+				break;
+			case 2u:
+				static_cast<i16*>(table)[slot] = i16(entry_index);
+				break;
+			default:
+				static_cast<i32*>(table)[slot] = entry_index;
 			}
+		}
 
-			len_of_deleted = 0u;
+		inline i32 inline_get_index(u32 slot)
+		{
+			return inline_get_index(indices, capacity, slot);
 		}
 
-		// Thực hiện băm lại từ vào "array_hash".
-		// (!) : chỉ sử dụng hàm khi "len_of_deleted" = 0.
-		// (!) : chỉ sử dụng khi toàn bộ "array_hash" là INT32_MAX.
-		inline void inline_restructure_entry_index()
+		inline void inline_set_index(u32 slot, i32 entry_index)
 		{
-			u64 hash_value;
-			u32 index;
-			for (u32 i = 0u; i < len; ++i)
-			{
-				hash_value = ordered_entries[i].hash_value;
+			inline_set_index(indices, capacity, slot, entry_index);
+		}
 
-				for (u32 number = 1;; ++number)
-				{
-					index = inline_probing(hash_value, number);
+		// Hash dùng để dò của "key_hash".
+		inline u64 inline_probe_hash(u64 key_hash)
+		{
+			return hash_finalize(key_hash, hash_policy);
+		}
 
-					// Collision
-					if (ordered_entries[index].entry_index != INT32_MAX)
-						continue;
+		// Vị trí dò tiếp theo.
+		static inline u32 inline_next_slot(u32 slot, u64& perturb, u32 table_capacity)
+		{
+			perturb >>= PERTURB_SHIFT;
+			return u32(slot * 5u + perturb + 1u) & (table_capacity - 1u);
+		}
 
-					// Index at entry_index is empty.
-					ordered_entries[index].entry_index = i;
-					ordered_entries[i].entry_index = index;
-				}
-			}
+		// Kiểm tra phần tử "entry_index" còn nằm trong bảng cũ.
+		inline bool inline_is_old_entry(u32 entry_index)
+		{
+			return old_entries != nullptr && entry_index >= migrate_index && entry_index < old_len_of_entries;
 		}
 
+		// Phần tử "entry_index" trong bảng đang chứa nó.
+		inline EntryPair& inline_entry(u32 entry_index)
+		{
+			return inline_is_old_entry(entry_index) ? old_entries[entry_index] : ordered_entries[entry_index];
+		}
 
-		// Nếu "key" có tồn tại trong Map, trả về -1.
-		// Nếu Map rỗng, trả về -2.
-		// Nếu không tồn tại, trả về vị trí tiếp theo của nó trong bảng băm.
-		// (!) : hàm không giải phóng bất kỳ.
-		inline i32 inline_find_entry_index(Object* key, u64 key_hash)
+		// Dò "key" trong "indices" ( hoặc "old_indices" nếu "in_old" ), bỏ qua phần tử không thuộc bảng đó.
+		inline i32 inline_probe(bool in_old, Object* key, u64 key_hash, u32& slot)
 		{
-			if (len == 0u)
-				return -2;
+			auto table = in_old ? old_indices : indices;
+			auto table_capacity = in_old ? old_capacity : capacity;
 
-			u32 index;
-			i32 mapping;
-			i32 entry_index_is_deleted = -1;
-			for (u32 i = 1u;; ++i)
+			u64 perturb = inline_probe_hash(key_hash);
+			slot = u32(perturb) & (table_capacity - 1u);
+			for (;;)
 			{
-				index = inline_probing(key_hash, i);
-				mapping = ordered_entries[index].entry_index;
+				auto entry_index = inline_get_index(table, table_capacity, slot);
+				if (entry_index == INDEX_EMPTY)
+					return -1;
 
-				// Empty -> not contains
-				if (mapping == INT32_MAX)
-				{
-					if (entry_index_is_deleted != -1)
-						return entry_index_is_deleted;
-					return i32(index);
-				}
-					
-				if (mapping < 0)	// Bị đánh dấu "deleted"
+				if (entry_index >= 0 && inline_is_old_entry(u32(entry_index)) == in_old)
 				{
-					entry_index_is_deleted = index;
-					continue;
+					auto& entry_pair = inline_entry(u32(entry_index));
+					if (entry_pair.hash_value == key_hash &&
+						(entry_pair.key == key || key->equal(entry_pair.key)))
+						return entry_index;
 				}
 
-				// Kiểm tra giá trị băm
-				if (key_hash != ordered_entries[mapping].hash_value)
-					continue;
+				slot = inline_next_slot(slot, perturb, table_capacity);
+			}
+		}
+
+		// Tìm "key", trả về vị trí trong "ordered_entries", -1 nếu không tồn tại.
+		// "slot" : ô chứa "key" ( trong bảng đang chứa phần tử ) nếu tồn tại,
+		// ngược lại là ô trống đầu tiên trên đường dò của "indices" ( không xác định nếu Map chưa cấp phát ).
+		// Chuyển PYCPP_REHASH_STEP phần tử nếu đang tăng trưởng tăng dần.
+		// (!) : hàm không giải phóng bất kỳ.
+		inline i32 inline_lookup(Object* key, u64 key_hash, u32& slot)
+		{
+			if (capacity == 0u)
+				return -1;
+
+			// OrderedMap đã freeze có thể được đọc đồng thời : không chuyển phần tử
+			if (!is_frozen())
+				allocation_migrate(PYCPP_REHASH_STEP);
+
+			auto entry_index = inline_probe(false, key, key_hash, slot);
+			if (entry_index != -1 || old_entries == nullptr)
+				return entry_index;
+
+			u32 old_slot;
+			entry_index = inline_probe(true, key, key_hash, old_slot);
+			if (entry_index != -1)
+				slot = old_slot;
+			return entry_index;
+		}
 
-				// So sánh "equal"
-				if (key->equal(ordered_entries[mapping].key) == false)
-					continue;
+		// Tìm ô trống đầu tiên trên đường dò của "key_hash" ( trong "indices" ).
+		inline u32 inline_find_empty_slot(u64 key_hash)
+		{
+			u64 perturb = inline_probe_hash(key_hash);
+			u32 slot = u32(perturb) & (capacity - 1u);
+			while (inline_get_index(slot) != INDEX_EMPTY)
+				slot = inline_next_slot(slot, perturb, capacity);
+			return slot;
+		}
 
-				break;
-			}
+		// Tìm ô ( trong bảng đang chứa phần tử ) trỏ tới phần tử "entry_index".
+		inline u32 inline_find_slot_of(i32 entry_index)
+		{
+			bool in_old = inline_is_old_entry(u32(entry_index));
+			auto table = in_old ? old_indices : indices;
+			auto table_capacity = in_old ? old_capacity : capacity;
+
+			u64 perturb = inline_probe_hash(inline_entry(u32(entry_index)).hash_value);
+			u32 slot = u32(perturb) & (table_capacity - 1u);
+			while (inline_get_index(table, table_capacity, slot) != entry_index)
+				slot = inline_next_slot(slot, perturb, table_capacity);
+			return slot;
+		}
+
+		// Cập nhật "live_tree" tại phần tử "entry_index" ( nếu đã tạo ).
+		inline void inline_tree_add(u32 entry_index, u32 delta)
+		{
+			if (live_tree == nullptr)
+				return;
 
-			return -1;	// Exist
+			u32 tree_size = inline_usable(capacity);
+			for (u32 i = entry_index + 1u; i <= tree_size; i += i & (0u - i))
+				live_tree[i] += delta;
 		}
 
-		// Tìm Entry từ bên trái với vị trí "index".
-		// Chỉ dùng khi "len_of_deleted" khác 0.
+		// Tìm vị trí trong "ordered_entries" của phần tử thứ "index" ( tính từ 0, bỏ qua phần tử đã xóa ).
+		// O(1) nếu không có phần tử bị xóa ( luôn đúng với OrderedMap đã freeze ), ngược lại O(log n).
 		// (!) : giá trị "index" hợp lệ là [0, len).
-		inline i32 inline_find_from_left(i32 index)
+		inline i32 inline_find_entry(u32 index)
 		{
-			i32 counter = -1, i = 0;
-			for (; counter != index; ++i)
-				if (ordered_entries[i].key != nullptr)
-					++counter;
-			return i - 1;
+			if (len_of_deleted == 0u)
+				return i32(index);
+
+			if (live_tree == nullptr)
+				allocation_build_live_tree();
+
+			// Tìm kiếm nhị phân trên cây Fenwick
+			u32 tree_size = inline_usable(capacity);
+			u32 position = 0u, remaining = index + 1u;
+			for (u32 step = pycpp::find_next_power_of_two(tree_size) >> 1u; step; step >>= 1u)
+			{
+				if (position + step <= tree_size && live_tree[position + step] < remaining)
+				{
+					position += step;
+					remaining -= live_tree[position];
+				}
+			}
+
+			return i32(position);
 		}
 
-		// Tìm Entry từ bên phải với vị trí "index".
-		// Chỉ dùng khi "len_of_deleted" khác 0.
-		// (!) : giá trị "index" hợp lệ là [0, len)
-		inline i32 inline_find_from_right(i32 index)
+
+		// Ném lỗi runtime nếu OrderedMap đã bị freeze.
+		inline void inline_check_frozen(const char* block_location)
+		{
+			if (is_frozen())
+				__pycpp_error_modify_frozen_object(block_location, "OrderedMap");
+		}
+
+		// Thêm phần tử mới vào cuối "ordered_entries" tại ô "slot", nhận luôn tham chiếu của "key" và "value".
+		// (!) : hàm không kiểm tra tồn tại, "growth_left" phải khác 0.
+		inline void inline_insert(u32 slot, Object* key, Object* value, u64 key_hash)
 		{
-			i32 counter = -1, i = len + len_of_deleted;
-			for (; counter != index; --i)
-				if (ordered_entries[i].key != nullptr)
-					++counter;
-			return i + 1;
+			auto entry_index = len + len_of_deleted;
+			ordered_entries[entry_index] = { key, value, key_hash };
+			inline_set_index(slot, i32(entry_index));
+			inline_tree_add(entry_index, 1u);
+			++len;
+			--growth_left;
 		}
 
+		// Tách phần tử "entry_index" ( tại ô "slot" ) khỏi Map, trả về "key-value" ( không giảm tham chiếu ).
+		inline EntryPair inline_detach(u32 slot, i32 entry_index)
+		{
+			auto& entry_pair = inline_entry(u32(entry_index));
+			EntryPair result = entry_pair;
+
+			if (inline_is_old_entry(u32(entry_index)))
+				inline_set_index(old_indices, old_capacity, slot, INDEX_DUMMY);
+			else
+				inline_set_index(slot, INDEX_DUMMY);
+
+			inline_tree_add(u32(entry_index), u32(-1));
+			entry_pair.key = entry_pair.value = nullptr;
+			--len;
+			++len_of_deleted;
+
+			// Bỏ các phần tử bị xóa ở cuối : phần tử cuối cùng luôn còn "key" ( "pop" là O(1) ).
+			while (len_of_deleted != 0u && inline_entry(len + len_of_deleted - 1u).key == nullptr)
+				--len_of_deleted;
+
+			// Phần tử mới sẽ được thêm vào "ordered_entries" từ sau phần tử cuối cùng
+			u32 len_of_entries = len + len_of_deleted;
+			if (old_entries != nullptr && old_len_of_entries > len_of_entries)
+			{
+				old_len_of_entries = len_of_entries > migrate_index ? len_of_entries : migrate_index;
+				allocation_migrate(0u);
+			}
+
+			return result;
+		}
 
 		// Thêm cặp "key-value" vào Map, trả về "true" nếu thêm thành công.
 		// (!) : hàm không giải phóng bất kỳ.
 		inline bool inline_push_pair(EntryPair entry)
 		{
-			auto entry_index = inline_find_entry_index(entry.key, entry.hash_value);
-			if (entry_index == -1)	// "key" is exist
+			u32 slot;
+			if (inline_lookup(entry.key, entry.hash_value, slot) != -1)	// "key" is exist
 				return false;
-			if (entry_index == -2)	// Map rỗng
-				allocation_grow_when_empty();
-
-			// Thêm phần tử
-			auto index = len + len_of_deleted;
-			ordered_entries[index].set(entry.key, entry.value);
-			ordered_entries[index].mapping = entry_index;
-			ordered_entries[entry_index].entry_index = index;
-			++len;
 
-			// Tăng trưởng
-			if (len >= (capacity >> 1))
+			if (growth_left == 0u)
+			{
 				allocation_grow();
+				slot = inline_find_empty_slot(entry.hash_value);
+			}
+
+			INREF(entry.key);
+			INREF(entry.value);
+			inline_insert(slot, entry.key, entry.value, entry.hash_value);
 			return true;
 		}
 
@@ -284,62 +425,49 @@ namespace pycpp
 		#pragma region Initialize Methods
 
 		void init_from_hashtable(__HashTable* source);
+
+		// Sao chép "source" ( bỏ các phần tử đã xóa ), không giải phóng "source".
 		void init_from_ordered_dictionary(OrderedMap* source);
 
 		#pragma endregion
 
 		#pragma region Allocation
 
-		// Từ Map rỗng, tăng trưởng thành capacity = 3
-		inline void allocation_grow_when_empty()
-		{
-			capacity = 3u;
-			ordered_entries = new EntryPair[3u]
-			{
-				{ nullptr, nullptr, 0u, INT32_MAX, 0u },
-				{ nullptr, nullptr, 0u, INT32_MAX, 0u },
-				{ nullptr, nullptr, 0u, INT32_MAX, 0u }
-			};
-		}
-
-		// Map trở thành rỗng.
-		// (!) : có thể có 1 hoặc không có phần tử, hàm kiểm tra và xóa nó.
-		inline void allocation_shrink_to_emptry()
-		{
-			// Delete element if have
-			if (len == 0u)
-			{
-				if (ordered_entries[0].key)
-					ordered_entries[0].clear();
-				else if (ordered_entries[1].key)
-					ordered_entries[1].clear();
-				else if (ordered_entries[2].key)
-					ordered_entries[2].clear();
-			}
+		// Giải phóng toàn bộ phần tử, Map trở thành rỗng ( không kiểm tra freeze ).
+		void allocation_release();
 
-			delete[] ordered_entries;
-			ordered_entries = nullptr;
-			capacity = len = len_of_deleted = 0u;
-		}
-
-		// Tăng trưởng gấp đôi dung lượng
+		// Tăng trưởng khi hết "growth_left" ( hoặc chỉ dồn phần tử nếu nhiều phần tử đã xóa ).
 		void allocation_grow();
 
-		// Giảm gấp đôi dung lượng
+		// Giảm dung lượng khi "len" dưới 1/8 số phần tử tối đa, còn gấp đôi chỗ trống sau khi giảm.
 		void allocation_shrink();
 
-		// Thay đổi dung lượng dựa vào "n_len"
-		// (!) : nếu "n_len" quá nhỏ dẫn đến "capacity < len" sẽ gây lỗi.
+		// Bắt đầu tăng trưởng tăng dần tới "n_capacity" ô băm ( giữ nguyên vị trí phần tử ).
+		// (!) : không có bảng cũ, "n_capacity" phải đủ chứa "len + len_of_deleted" phần tử.
+		void allocation_begin_migrate(u32 n_capacity);
+
+		// Chuyển tối đa "budget" phần tử của bảng cũ, giải phóng bảng cũ khi đã chuyển hết.
+		void allocation_migrate(u32 budget);
+
+		// Hoàn tất tăng trưởng tăng dần ( nếu có ).
+		void allocation_finish_migrate();
+
+		// Tăng dung lượng đủ chứa "n_len" phần tử.
 		void allocation_resize_based_on_len(u32 n_len);
 
-		// Thay đổi dung lượng thành "n_capacity".
-		// (!) : "n_capacity" không phù hợp có thể gây ra lỗi.
-		// (!) : hàm không thực hiện bước trở thành rỗng.
+		// Cấp phát lại với "n_capacity" ô băm, dồn các phần tử còn lại về đầu "ordered_entries".
+		// (!) : "n_capacity" phải đủ chứa "len" phần tử.
 		void allocation_resize_capacity(u32 n_capacity);
 
 		// Xóa những đánh dấu về "phần tử đã bị xóa".
 		void allocation_restructure();
 
+		// Tạo "live_tree" từ "ordered_entries", O(n).
+		void allocation_build_live_tree();
+
+		// Hoàn tất mọi thay đổi cấu trúc còn dở, được "freeze" gọi trước khi đánh dấu.
+		void allocation_prepare_freeze();
+
 		#pragma endregion
 
 		#pragma region Standard Methods
@@ -358,6 +486,16 @@ namespace pycpp
 
 		#pragma endregion
 
+		#pragma region Override Object
+
+		i64 type() override;
+		Object* as_object() override;
+		std::string class_name() override;
+		void traverse(TraverseVisitor visit, void* context) override;
+		void clear_references() override;
+
+		#pragma endregion
+
 		#pragma region Override Arguments
 
 		bool is_empty() override;
@@ -413,6 +551,31 @@ namespace pycpp
 		// Xóa cặp "key-value" ra khỏi OrderedMap.
 		void remove(Object* key);
 
+		// Trả về ArrayList chứa các "key" theo thứ tự thêm vào.
+		Iterable* keys() override;
+
+		// Trả về ArrayList chứa các "value" theo thứ tự thêm vào.
+		Iterable* values() override;
+
+		// Trả về ArrayList chứa các Pair "key-value" theo thứ tự thêm vào.
+		Iterable* items() override;
+
+		#pragma endregion
+
+		#pragma region Hash Policy
+
+		// Đổi cách trộn hash ( xem HashPolicy ), băm lại toàn bộ phần tử.
+		void set_hash_policy(HashPolicy policy);
+		HashPolicy get_hash_policy();
+
+		#pragma endregion
+
+		#pragma region Steal Reference
+
+		// Tương tự "set" nhưng nhận luôn tham chiếu của người gọi với "key" và "value" ( không INREF ) :
+		// map->set_steal(key.release(), value.release()).
+		void set_steal(Object* key, Object* value);
+
 		#pragma endregion
 
 	#pragma endregion
@@ -424,18 +587,21 @@ namespace pycpp
 			friend OrderedMap;
 
 			OrderedMap* container;
+
+			// Vị trí trong "ordered_entries", -1 : kết thúc.
 			i32 index_of_entry;
 
 			iterator(OrderedMap* container, i32 index_of_entry);
 
 		public:
-			TYPE_ID(OrderedMap::iterator);
+			BUILTIN_TYPE_ID(OrderedMapIterator);
 
 			~iterator();
 
 			///==========     Override Object     ==========///
 
 			i64 type() override;
+			Object* as_object() override;
 			std::string class_name() override;
 			u32 bytes() override;
 
@@ -1,64 +1,107 @@
 #include "private_hashtable.hpp"
+#include "../base/algo.hpp"
+
+#include <cstring>
+
+#if !defined(PYCPP_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#endif
 
 namespace pycpp
 {
 
-#pragma region Definition : Entry
+#pragma region Definition : Control Group
 
-	Entry::Entry(Object* ref) :
-		ref(ref), hash_value(ref->hash()), next(nullptr)
-	{
-		INREF(ref);
-	}
+	// Dùng SWAR 64 bit thay cho SSE2 khi định nghĩa PYCPP_DISABLE_SIMD.
+#if !defined(PYCPP_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define PYCPP_HASHTABLE_SSE2 1
+#else
+#define PYCPP_HASHTABLE_SSE2 0
+#endif
 
-	Entry::Entry(Object* ref, Entry* pointer) :
-		ref(ref), hash_value(ref->hash()), next(pointer)
+	// Byte điều khiển của ô có phần tử ( 7 bit ).
+	static inline u8 hash_control(u64 mixed)
 	{
-		INREF(ref);
+		return u8(mixed & 0x7Fu);
 	}
 
-	Entry::Entry(Object* ref, u64 hash_value) :
-		ref(ref), hash_value(hash_value), next(nullptr)
+	// Nhóm GROUP_WIDTH byte điều khiển, mỗi hàm trả về mặt nạ 16 bit ( bit i : ô thứ i của nhóm ).
+	struct __ControlGroup final
 	{
-		INREF(ref);
-	}
+#if PYCPP_HASHTABLE_SSE2
+		__m128i bytes;
 
-	Entry::Entry(Object* ref, u64 hash_value, Entry* pointer) :
-		ref(ref), hash_value(hash_value), next(pointer)
-	{
-		INREF(ref);
-	}
+		inline explicit __ControlGroup(const u8* position) :
+			bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(position))) {}
 
-	Entry::Entry(Entry& source) :
-		ref(source.ref), hash_value(source.hash_value), next(nullptr)
-	{
-		INREF(ref);
-	}
+		inline u32 match(u8 value) const
+		{
+			return u32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(char(value)), bytes)));
+		}
 
-	Entry::Entry(Entry& source, Entry* pointer) :
-		ref(source.ref), hash_value(source.hash_value), next(pointer)
-	{
-		INREF(ref);
-	}
+		inline u32 match_empty() const
+		{
+			return match(0x80u);
+		}
 
-	Entry::~Entry()
-	{
-		if (ref)
+		// EMPTY ( -128 ) và DELETED ( -2 ) nhỏ hơn SENTINEL ( -1 ) khi so sánh có dấu.
+		inline u32 match_empty_or_deleted() const
 		{
-			DEREF(ref);
-			SAFE(ref);
+			return u32(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(char(0xFFu)), bytes)));
 		}
-	}
 
+		inline u32 match_full() const
+		{
+			return ~u32(_mm_movemask_epi8(bytes)) & 0xFFFFu;
+		}
+#else
+		static constexpr const u64 LSBS = 0x0101010101010101ull;
+		static constexpr const u64 MSBS = 0x8080808080808080ull;
 
-	inline Object* Entry::pop()
-	{
-		DEREF(ref);
+		u64 low, high;
 
-		auto result = ref;
-		ref = nullptr;
-		return result;
-	}
+		inline explicit __ControlGroup(const u8* position)
+		{
+			std::memcpy(&low, position, 8u);
+			std::memcpy(&high, position + 8u, 8u);
+		}
+
+		// Gom bit cao của 8 byte thành 8 bit.
+		static inline u32 compress(u64 mask)
+		{
+			return u32(((mask >> 7u) * 0x0102040810204080ull) >> 56u);
+		}
+
+		static inline u64 match_word(u64 word, u8 value)
+		{
+			auto x = word ^ (LSBS * value);
+			return (x - LSBS) & ~x & MSBS;
+		}
+
+		// Có thể khớp nhầm ô có phần tử ngay sau ô khớp, người gọi luôn so sánh lại hash.
+		inline u32 match(u8 value) const
+		{
+			return compress(match_word(low, value)) | compress(match_word(high, value)) << 8u;
+		}
+
+		// EMPTY ( 0x80 ) : bit 7 bật và bit 1 tắt.
+		inline u32 match_empty() const
+		{
+			return compress(low & ~(low << 6u) & MSBS) | compress(high & ~(high << 6u) & MSBS) << 8u;
+		}
+
+		// EMPTY ( 0x80 ), DELETED ( 0xFE ) : bit 7 bật và bit 0 tắt.
+		inline u32 match_empty_or_deleted() const
+		{
+			return compress(low & ~(low << 7u) & MSBS) | compress(high & ~(high << 7u) & MSBS) << 8u;
+		}
+
+		inline u32 match_full() const
+		{
+			return compress(~low & MSBS) | compress(~high & MSBS) << 8u;
+		}
+#endif
+	};
 
 #pragma endregion
 
@@ -69,40 +112,45 @@ namespace pycpp
 		#pragma region Constructors & Destructors
 
 	__HashTable::__HashTable() :
-		data(nullptr), capacity(0u), len(0u) {}
-
-	__HashTable::__HashTable(std::initializer_list<Object*> list)
-	{
-		capacity = find_capacity((u32) list.size());
-		data = new Entry * [capacity];
-		pycpp::fill<Entry*>(data, capacity, nullptr);
+		control(nullptr), data(nullptr), capacity(0u), len(0u), growth_left(0u), pop_index(0u),
+		old_control(nullptr), old_data(nullptr), old_capacity(0u), migrate_index(0u),
+		hash_policy(PYCPP_HASH_POLICY) {}
 
-		only_extend(list);	// Hàm có gán "len"
-	}
-
-	__HashTable::__HashTable(__HashTable& source)
+	__HashTable::__HashTable(std::initializer_list<Object*> list) :
+		__HashTable()
 	{
-		extend_from_hashtable(&source);
+		extend(list);
 	}
 
-	__HashTable::__HashTable(Iterable* iterable)
+	__HashTable::__HashTable(__HashTable& source) :
+		__HashTable()
 	{
-		auto __array = dynamic_cast<__Array*>(iterable);
-		if (__array)
-		{
-			extend_from_array(__array);
+		hash_policy = source.hash_policy;
+		if (source.len == 0u)
 			return;
-		}
 
-		auto __hashtable = dynamic_cast<__HashTable*>(iterable);
-		if (__hashtable)
-		{
-			extend_from_hashtable(__hashtable);
-			return;
-		}
+		// Sao chép nguyên mảng băm, không cần băm lại
+		source.finish_rehash();
+		capacity = source.capacity;
+		len = source.len;
+		growth_left = source.growth_left;
 
-		extend_from_iterable(iterable);
+		u32 control_size = group_count(capacity) * GROUP_WIDTH;
+		control = new u8[control_size];
+		std::memcpy(control, source.control, control_size);
 
+		data = new Entry[capacity];
+		std::memcpy(data, source.data, capacity * sizeof(Entry));
+
+		for (u32 i = 0u; i < capacity; ++i)
+			if (is_full(i))
+				INREF(data[i].ref);
+	}
+
+	__HashTable::__HashTable(Iterable* iterable) :
+		__HashTable()
+	{
+		extend(iterable);
 	}
 
 	__HashTable::~__HashTable()
@@ -110,36 +158,45 @@ namespace pycpp
 		clear();
 	}
 
+	Object* __HashTable::as_object()
+	{
+		// Note : mọi class buộc phải kế thừa Object
+		return dynamic_cast<Object*>(this);
+	}
+
 		#pragma endregion
 
 		#pragma region Inline Methods
 
-	inline u32 __HashTable::index_hashing(u64 hash_value)
+	inline u32 __HashTable::group_count(u32 n_capacity)
 	{
-		return (hash_value & capacity) - 1u;
+		return n_capacity < GROUP_WIDTH ? 1u : n_capacity / GROUP_WIDTH;
 	}
 
 	inline u32 __HashTable::find_capacity(u32 n_len)
 	{
-		auto power_of_2 = pycpp::find_next_power_of_two(n_len);
-		return (power_of_2 << 1u) - 1u;
+		u32 n_capacity = MIN_CAPACITY;
+		while (growth_limit(n_capacity) < n_len)
+			n_capacity <<= 1u;
+		return n_capacity;
+	}
+
+	inline u32 __HashTable::growth_limit(u32 n_capacity)
+	{
+		return (n_capacity >> 3u) * 7u + ((n_capacity & 7u) * 7u >> 3u);
 	}
 
 
 	inline i32 __HashTable::first_entry()
 	{
-		u32 i = 0u;
-		for (; i < capacity; ++i)
-			if (data[i] != nullptr)
-				return i;
-		return -1;
+		return len == 0u ? -1 : next_entry(u32(-1));
 	}
 
 	inline i32 __HashTable::next_entry(u32 prev_entry)
 	{
 		u32 i = prev_entry + 1u;
 		for (; i < capacity; ++i)
-			if (data[i] != nullptr)
+			if (is_full(i))
 				return i;
 		return -1;
 	}
@@ -148,155 +205,238 @@ namespace pycpp
 	{
 		i32 i = capacity - 1;
 		for (; i >= 0; --i)
-			if (data[i] != nullptr)
+			if (is_full(i))
 				return i;
 		return -1;
 	}
 
 
-	inline bool __HashTable::exist_in_entry(Entry* head, Object* item, u64 hash_value)
+	inline i32 __HashTable::find_in(const u8* table_control, const Entry* table_data, u32 table_capacity,
+		Object* item, u64 hash_value)
 	{
-		for (; head; head = head->next)
-			if (hash_value == head->hash_value &&
-				item->equal(head->ref))
-				break;
+		auto mixed = hash_finalize(hash_value, hash_policy);
+		auto value = hash_control(mixed);
+		u32 mask = group_count(table_capacity) - 1u;
+		u32 group = u32(mixed >> 7u) & mask;
+
+		// Dò tối đa "group_count" nhóm
+		for (u32 step = 1u; step <= mask + 1u; ++step)
+		{
+			u32 base = group * GROUP_WIDTH;
+			__ControlGroup current(table_control + base);
+
+			for (u32 matched = current.match(value); matched; matched &= matched - 1u)
+			{
+				auto& entry = table_data[base + count_trailing_zeros(matched)];
+				if (entry.hash_value == hash_value && item->equal(entry.ref))
+					return i32(base + count_trailing_zeros(matched));
+			}
 
-		return head != nullptr;
+			// Nhóm còn ô trống : phần tử chưa từng được đặt xa hơn
+			if (current.match_empty())
+				return -1;
+
+			group = (group + step) & mask;
+		}
+
+		return -1;
 	}
 
+	inline i32 __HashTable::find_index(Object* item, u64 hash_value)
+	{
+		if (len == 0u)
+			return -1;
+
+		return find_in(control, data, capacity, item, hash_value);
+	}
 
-	inline void __HashTable::grow_when_empty()
+	inline Object* __HashTable::find_object(Object* item, u64 hash_value)
 	{
-		data = new Entry * [3]{ nullptr, nullptr, nullptr };
-		capacity = 3;
+		auto index = find_index(item, hash_value);
+		if (index != -1)
+			return data[index].ref;
+
+		if (old_data == nullptr)
+			return nullptr;
+
+		index = find_in(old_control, old_data, old_capacity, item, hash_value);
+		return index != -1 ? old_data[index].ref : nullptr;
 	}
 
-	inline void __HashTable::shrink_to_empty()
+	inline u32 __HashTable::find_insert_index(u64 hash_value)
 	{
-		Entry* elem = nullptr;
-		if (data[0] != nullptr)
-			elem = data[0];
-		else if (data[1] != nullptr)
-			elem = data[1];
-		else if (data[2] != nullptr)
-			elem = data[2];
+		auto mixed = hash_finalize(hash_value, hash_policy);
+		u32 mask = group_count(capacity) - 1u;
+		u32 group = u32(mixed >> 7u) & mask;
 
-		if (elem != nullptr)
+		for (u32 step = 1u; ; ++step)
 		{
-			// Giải phóng phần tử
-			DEREF(elem->ref);
-			SAFE(elem->ref);
+			u32 base = group * GROUP_WIDTH;
+			u32 matched = __ControlGroup(control + base).match_empty_or_deleted();
+			if (matched)
+				return base + count_trailing_zeros(matched);
 
-			// Giải phóng nút
-			delete elem;
+			group = (group + step) & mask;
 		}
-
-		delete[] data;
-		data = nullptr;
-		capacity = 0u;
 	}
 
+	inline void __HashTable::insert_at(u32 index, Object* item, u64 hash_value)
+	{
+		if (control[index] == CONTROL_EMPTY)
+			--growth_left;
+
+		control[index] = hash_control(hash_finalize(hash_value, hash_policy));
+		data[index] = { item, hash_value };
+		++len;
+	}
 
-	inline void __HashTable::only_extend(std::initializer_list<Object*> list)
+	inline Object* __HashTable::erase_at(u32 index)
 	{
-		u32 list_size = (u32) list.size();
-		auto iter = list.begin();
+		auto result = data[index].ref;
+		data[index].ref = nullptr;
+		--len;
 
-		// Duyệt "list"
-		for (u32 i = 0u; i < list_size; ++i)
+		// Nhóm còn ô trống ( hoặc chỉ có một nhóm ) : không đường dò nào đi qua nhóm này
+		u32 base = index - index % GROUP_WIDTH;
+		if (group_count(capacity) == 1u || __ControlGroup(control + base).match_empty())
 		{
-			// Tìm đến Entry
-			auto item = iter[i];
-			u64 hash_value = item->hash();
-			auto& entry_head = data[index_hashing(hash_value)];
+			control[index] = CONTROL_EMPTY;
+			++growth_left;
+		}
+		else
+			control[index] = CONTROL_DELETED;
 
-			// Kiểm tra tồn tại
-			if (exist_in_entry(entry_head, item, hash_value))
-			{
-				SAFE(item);
-				continue;
-			}
+		return result;
+	}
 
-			// Tạo nút Entry
-			++len;
-			auto entry = new Entry(iter[i], hash_value);
 
-			if (entry_head == nullptr)
-				entry_head = entry;
-			else {
-				entry->next = entry_head;
-				entry_head = entry;
-			}
-		}
+	inline void __HashTable::allocate(u32 n_capacity)
+	{
+		capacity = n_capacity;
+		growth_left = growth_limit(n_capacity);
+		pop_index = 0u;
+
+		u32 control_size = group_count(capacity) * GROUP_WIDTH;
+		control = new u8[control_size];
+		std::memset(control, CONTROL_EMPTY, capacity);
+		std::memset(control + capacity, CONTROL_SENTINEL, control_size - capacity);
+
+		// Không khởi tạo "data" : ô được xác định bởi byte điều khiển, trang nhớ chỉ được chạm khi dùng
+		data = new Entry[capacity];
 	}
 
 		#pragma endregion
 
 		#pragma region Allocation
 
-	void __HashTable::grow()
+	void __HashTable::rehash(u32 n_capacity)
 	{
-		if (len == 0u)
-		{
-			grow_when_empty();
+		finish_rehash();
+
+		old_control = control;
+		old_data = data;
+		old_capacity = capacity;
+		migrate_index = 0u;
+
+		allocate(n_capacity);
+
+		// Dành chỗ cho các phần tử của bảng cũ
+		growth_left -= len;
+
+		if (n_capacity < PYCPP_INCREMENTAL_REHASH_CAPACITY)
+			finish_rehash();
+		else
+			rehash_step(PYCPP_REHASH_STEP);
+	}
+
+	void __HashTable::rehash_step(u32 budget)
+	{
+		if (old_data == nullptr)
 			return;
+
+		u32 end = old_capacity - migrate_index > budget ? migrate_index + budget : old_capacity;
+		for (; migrate_index < end; ++migrate_index)
+		{
+			if (old_control[migrate_index] >= CONTROL_EMPTY)
+				continue;
+
+			// Tính lại byte điều khiển : "hash_policy" có thể đã thay đổi
+			auto& entry = old_data[migrate_index];
+			auto index = find_insert_index(entry.hash_value);
+			control[index] = hash_control(hash_finalize(entry.hash_value, hash_policy));
+			data[index] = entry;
+
+			old_control[migrate_index] = CONTROL_DELETED;
+			entry.ref = nullptr;
 		}
 
-		auto head = connect_entry();
+		if (migrate_index == old_capacity)
+		{
+			delete[] old_control;
+			delete[] old_data;
+			old_control = nullptr;
+			old_data = nullptr;
+			old_capacity = migrate_index = 0u;
+		}
+	}
 
-		// Tăng dung lượng
-		delete[] data;
+	void __HashTable::finish_rehash()
+	{
+		if (old_data != nullptr)
+			rehash_step(old_capacity);
+	}
 
-		capacity = capacity << 1u | 1u;
-		data = new Entry * [capacity];
-		pycpp::fill<Entry*>(data, capacity, nullptr);
+	void __HashTable::set_hash_policy(HashPolicy policy)
+	{
+		if (policy == hash_policy)
+			return;
 
-		// Tái cấu trúc
-		restructure(head);
+		// Bảng cũ phải được dò bằng cách trộn cũ : băm lại một lần
+		finish_rehash();
+		hash_policy = policy;
+		if (capacity != 0u)
+		{
+			rehash(capacity);
+			finish_rehash();
+		}
 	}
 
-	void __HashTable::shrink()
+	void __HashTable::grow()
 	{
-		if (capacity == 3u)
+		if (capacity == 0u)
 		{
-			shrink_to_empty();
+			allocate(MIN_CAPACITY);
 			return;
 		}
 
-		auto head = connect_entry();
-
-		// Giảm dung lượng
-		delete[] data;
-
-		capacity >>= 1u;
-		data = new Entry * [capacity];
-		pycpp::fill<Entry*>(data, capacity, nullptr);
+		// Hơn một nửa ngưỡng là ô đã xóa : băm lại tại chỗ
+		if (len <= (growth_limit(capacity) >> 1u))
+			rehash(capacity);
+		else
+			rehash(capacity << 1u);
+	}
 
-		// Tái cấu trúc
-		restructure(head);
+	void __HashTable::shrink()
+	{
+		// Còn gấp đôi chỗ trống sau khi giảm
+		auto n_capacity = find_capacity(len << 1u);
+		if (n_capacity < capacity)
+			rehash(n_capacity);
 	}
 
 	void __HashTable::resize_based_on_len(u32 n_len)
 	{
-		auto n_capacity = find_capacity(n_len);
-		if (capacity == n_capacity)
+		if (n_len <= len)
 			return;
 
-		Entry* head = nullptr;
-		if (data != nullptr && len != 0u)
+		if (capacity == 0u)
 		{
-			head = connect_entry();
-			delete[] data;
+			allocate(find_capacity(n_len));
+			return;
 		}
 
-		// Tạo mảng băm phù hợp
-		capacity = n_capacity;
-		data = new Entry * [capacity];
-		pycpp::fill<Entry*>(data, capacity, nullptr);
-
-		// Tái cấu trúc
-		if(head)
-			restructure(head);
+		if (n_len - len > growth_left)
+			rehash(find_capacity(n_len));
 	}
 
 		#pragma endregion
@@ -308,26 +448,25 @@ namespace pycpp
 		if (data == nullptr)
 			return;
 
-		for (u32 i = 0u; i < capacity; ++i)
-		{
-			auto head = data[i];
-			if (head == nullptr)
-				continue;
+		// Tách mảng băm trước khi giải phóng phần tử
+		u8* tables_control[2] = { control, old_control };
+		Entry* tables_data[2] = { data, old_data };
+		u32 tables_capacity[2] = { capacity, old_capacity };
 
-			for (; head;)
-			{
-				// Tách nút đầu
-				auto cur = head;
-				head = head->next;
+		control = old_control = nullptr;
+		data = old_data = nullptr;
+		capacity = len = growth_left = pop_index = 0u;
+		old_capacity = migrate_index = 0u;
 
-				// Giải phóng Entry
-				delete cur;
-			}
-		}
+		for (u32 table = 0u; table < 2u; ++table)
+		{
+			for (u32 i = 0u; i < tables_capacity[table]; ++i)
+				if (tables_control[table][i] < CONTROL_EMPTY)
+					DECREF(tables_data[table][i].ref);
 
-		delete[] data;
-		data = nullptr;
-		capacity = len = 0u;
+			delete[] tables_control[table];
+			delete[] tables_data[table];
+		}
 	}
 
 	void __HashTable::output()
@@ -343,73 +482,48 @@ namespace pycpp
 		if (len == 0u)
 			return;
 
-		auto this_object = dynamic_cast<Object*>(this);
+		finish_rehash();
+		auto this_object = as_object();
 		bool first_print = true;
-		auto __entry_index = first_entry();
-		auto head = data[__entry_index];
 
 		std::string str_current;
-		while (true)
+		for (auto index = first_entry(); index != -1; index = next_entry(index))
 		{
-			// "head" duyệt hết Entry
-			for (; head; head = head->next)
-			{
-				if (this_object == head->ref)
-					str_current = "this";
-				else
-					head->ref->output(str_current);
-
-				if (first_print == false)
-					str_current = ", " + str_current;
-				first_print = false;
-
-				out += str_current;
-			}
+			auto current = data[index].ref;
+			if (this_object == current)
+				str_current = "this";
+			else
+				current->output(str_current);
 
-			__entry_index = next_entry(__entry_index);
-			if (__entry_index == -1)
-				break;
+			if (first_print == false)
+				str_current = ", " + str_current;
+			first_print = false;
 
-			// Nhảy tới Entry kế
-			head = data[__entry_index];
+			out += str_current;
 		}
 	}
 
 	Iterator* __HashTable::first()
 	{
-		if (len == 0)
-			return new __HashTable::iterator(this, 0);
-
-		return new __HashTable::iterator(this, first_entry(), true);
+		finish_rehash();
+		return new __HashTable::iterator(this, first_entry());
 	}
 
 	Iterator* __HashTable::last()
 	{
-		if (len == 0)
-			return new __HashTable::iterator(this, -1);
-
-		return new __HashTable::iterator(this, last_entry(), false);
+		finish_rehash();
+		return new __HashTable::iterator(this, last_entry());
 	}
 
 	Object* __HashTable::get(Object* elem)
 	{
-		u64 hash_value = elem->hash();
-		Object* result = nullptr;
-
-		// Tìm "elem"
-		auto head = data[index_hashing(hash_value)];
-		for (; head; head = head->next)
-			if (hash_value == head->hash_value &&
-				elem->equal(head->ref))
-			{
-				result = head->ref;
-				break;
-			}
+		rehash_step(PYCPP_REHASH_STEP);
+		auto result = find_object(elem, elem->hash());
 
 		// Runtime error
 		if (result == nullptr)
 		{
-			auto __class_name = dynamic_cast<Object*>(this)->class_name();
+			auto __class_name = as_object()->class_name();
 			char content_error[128];
 			sprintf_s(content_error,
 				"Error in %s::get(Object) : unable to get an element"
@@ -437,12 +551,17 @@ namespace pycpp
 		return push(item, item->hash());
 	}
 
+	bool __HashTable::push_steal(Object* item)
+	{
+		return push_steal(item, item->hash());
+	}
+
 	Object* __HashTable::pop()
 	{
 		// Error : retrieve from an empty Container
 		if (len == 0u)
 		{
-			auto object = dynamic_cast<Object*>(this);
+			auto object = as_object();
 			char block_location[32];
 			sprintf_s(block_location, "%s::pop()",
 				object->class_name().c_str());
@@ -452,34 +571,54 @@ namespace pycpp
 			return nullptr;
 		}
 
-		i32 index = first_entry();
-		Entry* entry = data[index];
-		
-		// Tách Entry khỏi "this"
-		data[index] = entry->next;
-		--len;
+		rehash_step(PYCPP_REHASH_STEP);
+
+		// Lấy từ bảng cũ tại vị trí đang chuyển ( các ô trước đó đã trống )
+		while (old_data != nullptr && old_control[migrate_index] >= CONTROL_EMPTY)
+			rehash_step(1u);
+
+		Object* result = nullptr;
+		if (old_data != nullptr)
+		{
+			result = old_data[migrate_index].ref;
+			old_control[migrate_index] = CONTROL_DELETED;
+			old_data[migrate_index].ref = nullptr;
+			--len;
+
+			// Trả lại chỗ đã dành trong bảng mới
+			++growth_left;
+			rehash_step(1u);
+		}
+		else
+		{
+			// Tìm từ vị trí "pop" lần trước để các lần "pop" liên tiếp không duyệt lại các ô đã trống
+			u32 index = pop_index;
+			while (is_full(index) == false)
+				index = index + 1u < capacity ? index + 1u : 0u;
+			pop_index = index;
+
+			result = erase_at(index);
+		}
 
-		// Giảm dung lượng nếu có thể
-		if (len <= (capacity >> 2u))
+		// Giảm dung lượng khi hệ số tải dưới 7/32 ( không giải phóng khi rỗng )
+		if (capacity > MIN_CAPACITY && len < (growth_limit(capacity) >> 2u))
 			shrink();
 
-		// Giải phóng Entry
-		auto result = entry->pop();
-		delete entry;
+		DEREF(result);
 		return result;
 	}
 
 
 	void __HashTable::extend(Iterable* iterable)
 	{
-		auto __array = dynamic_cast<__Array*>(iterable);
+		auto __array = as_array(iterable);
 		if (__array)
 		{
 			extend_from_array(__array);
 			return;
 		}
 
-		auto __hashtable = dynamic_cast<__HashTable*>(iterable);
+		auto __hashtable = as_hashtable(iterable);
 		if (__hashtable)
 		{
 			extend_from_hashtable(__hashtable);
@@ -498,75 +637,19 @@ namespace pycpp
 		// Tăng dung lượng nếu có thể
 		resize_based_on_len(len + list_size);
 
-		only_extend(list);
+		// Phần tử đã tồn tại được giải phóng nếu không còn tham chiếu
+		for (auto item : list)
+			push(item);
 	}
 
 		#pragma endregion
 
 		#pragma region Private Methods
 
-	Entry* __HashTable::connect_entry()
-	{
-		if (len == 0u)
-			return nullptr;
-
-		auto __entry_index = first_entry();
-		auto head = data[__entry_index];
-		auto cur = head;
-
-		// Nối các nút
-		while (true)
-		{
-			__entry_index = next_entry(__entry_index);
-			if (__entry_index == -1)
-				break;
-
-			// "cur" đi đến nút cuối của "head"
-			while (cur->next)
-				cur = cur->next;
-
-			// Nối
-			cur->next = data[__entry_index];
-		}
-
-		return head;
-	}
-
-	void __HashTable::restructure(Entry* head)
-	{
-		Entry* cur = nullptr;
-		u32 index;
-
-		for (; head != nullptr;)
-		{
-			// Tách nút đầu khỏi danh sách
-			cur = head;
-			head = head->next;
-			cur->next = nullptr;
-
-			// Băm
-			index = index_hashing(cur->hash_value);
-
-			if (data[index] == nullptr)
-				data[index] = cur;
-			else {
-				cur->next = data[index];
-				data[index] = cur;
-			}
-		}
-	}
-
-
 	bool __HashTable::contains(Object* elem, u64 hash_value)
 	{
-		if (len == 0u)
-		{
-			SAFE(elem);
-			return false;
-		}
-
-		auto* head = data[index_hashing(hash_value)];
-		bool result = exist_in_entry(head, elem, hash_value);
+		rehash_step(PYCPP_REHASH_STEP);
+		bool result = find_object(elem, hash_value) != nullptr;
 
 		SAFE(elem);
 		return result;
@@ -575,33 +658,31 @@ namespace pycpp
 
 	bool __HashTable::push(Object* item, u64 hash_value)
 	{
-		// Nếu "this" rỗng
-		if (len == 0u)
-		{
-			grow_when_empty();
-			data[index_hashing(hash_value)] = new Entry(item, hash_value);
-			len = 1u;
-			return true;
-		}
+		INREF(item);
+		return push_steal(item, hash_value);
+	}
 
-		auto& head = data[index_hashing(hash_value)];
-		if (exist_in_entry(head, item, hash_value))
+	bool __HashTable::push_steal(Object* item, u64 hash_value)
+	{
+		rehash_step(PYCPP_REHASH_STEP);
+		if (find_object(item, hash_value) != nullptr)
 		{
-			SAFE(item);
+			DECREF(item);
 			return false;
 		}
 
-		// Thêm Entry vào mảng băm
-		if (head == nullptr)
-			head = new Entry(item, hash_value);
-		else
-			head = new Entry(item, hash_value, head);
-		++len;
+		if (capacity == 0u)
+			grow();
 
-		// Tăng trưởng nếu vượt ngưỡng
-		if (len > (capacity >> 1u))
+		// Ô đã xóa được dùng lại mà không cần tăng trưởng
+		auto index = find_insert_index(hash_value);
+		if (growth_left == 0u && control[index] != CONTROL_DELETED)
+		{
 			grow();
+			index = find_insert_index(hash_value);
+		}
 
+		insert_at(index, item, hash_value);
 		return true;
 	}
 
@@ -618,22 +699,8 @@ namespace pycpp
 		resize_based_on_len(len + source_len);
 
 		// Mở rộng từ Array
-		Object* current = nullptr;
 		for (u32 i = 0u; i < source_len; ++i)
-		{
-			current = source->data[i];
-			auto hash_value = current->hash();
-			auto& head = data[index_hashing(hash_value)];
-
-			if (exist_in_entry(head, current, hash_value))
-				continue;
-
-			++len;
-			if (head == nullptr)
-				head = new Entry(source->data[i], hash_value);
-			else
-				head = new Entry(source->data[i], hash_value, head);
-		}
+			push(source->data[i]);
 
 		SAFE(source);
 	}
@@ -652,27 +719,11 @@ namespace pycpp
 		// Tăng dung lượng mảng băm nếu cần thiết
 		resize_based_on_len(len + source->len);
 
-		for (u32 i = 0u; i < capacity; ++i)
-		{
-			auto head = source->data[i];
-			if (head == nullptr)
-				continue;
-
-			for (; head; head = head->next)	// Duyệt Entry của "source"
-			{
-				auto& entry = data[index_hashing(head->hash_value)];
-
-				// Tồn tại => bỏ qua
-				if (exist_in_entry(entry, head->ref, head->hash_value))
-					continue;
-
-				++len;
-				if (entry == nullptr)
-					entry = new Entry(*head);
-				else
-					entry = new Entry(head->ref, head->hash_value, entry);
-			}
-		}
+		// Dùng lại hash đã lưu của "source"
+		source->finish_rehash();
+		for (u32 i = 0u; i < source->capacity; ++i)
+			if (source->is_full(i))
+				push(source->data[i].ref, source->data[i].hash_value);
 
 		SAFE(source);
 	}
@@ -692,47 +743,39 @@ namespace pycpp
 		auto iter = iterable->first();
 
 		for (; iter->is_valid(); iter->next())
-		{
-			auto current = iter->get();
-			auto hash_value = current->hash();
-
-			auto& entry = data[index_hashing(hash_value)];
-			if (exist_in_entry(entry, current, hash_value))
-			{
-				SAFE(current);
-				continue;
-			}
-
-			++len;
-			if (entry == nullptr)
-				entry = new Entry(current, hash_value);
-			else
-				entry = new Entry(current, hash_value, entry);
-		}
+			push(iter->get());
 
 		SAFE(iter);
 		SAFE(iterable);
 	}
 
+	void __HashTable::traverse(TraverseVisitor visit, void* context)
+	{
+		// Không chuyển ô : bộ thu gom chỉ đọc
+		for (u32 i = 0u; i < capacity; ++i)
+			if (is_full(i))
+				visit(data[i].ref, context);
+
+		for (u32 i = migrate_index; i < old_capacity; ++i)
+			if (old_control[i] < CONTROL_EMPTY)
+				visit(old_data[i].ref, context);
+	}
+
 		#pragma endregion
 
 	#pragma endregion
 
 	#pragma region Iterator
 
-	__HashTable::iterator::iterator(__HashTable* container, i32 entry_index, bool first) :
-		container(container), entry_index(entry_index), entry(nullptr)
+	__HashTable::iterator::iterator(__HashTable* container, i32 entry_index) :
+		container(container), entry_index(entry_index)
 	{
 		INREF(container);
+	}
 
-		if (entry_index == -1 || entry_index == container->capacity)
-			return;
-
-		entry = container->data[entry_index];
-
-		if (first == false)	// last
-			while (entry->next)	// Tìm đến nút cuối
-				entry = entry->next;
+	__HashTable::iterator::~iterator()
+	{
+		DECREF(container);
 	}
 
 
@@ -741,6 +784,11 @@ namespace pycpp
 		return __HashTable::iterator::type_id;
 	}
 
+	Object* __HashTable::iterator::as_object()
+	{
+		return this;
+	}
+
 	std::string __HashTable::iterator::class_name()
 	{
 		return "__HashTable::iterator";
@@ -754,32 +802,22 @@ namespace pycpp
 
 	bool __HashTable::iterator::is_valid()
 	{
-		return entry_index == -1 || entry_index == container->capacity;
+		return entry_index != -1;
 	}
 
 	void __HashTable::iterator::next()
 	{
-		if (entry_index == container->capacity)
+		if (entry_index == -1)
 		{
 			char block_location[64];
 			sprintf_s(block_location, "%s::iterator::next",
-				dynamic_cast<Object*>(container)->class_name().c_str());
+				container->as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 			return;
 		}
 
-		entry = entry->next;
-		if (entry == nullptr)
-		{
-			// Tìm đến Entry kế tiếp
-			entry_index = container->next_entry(entry_index);
-
-			if (entry_index == -1)	// Điểm kết thúc cuối
-				entry_index = container->capacity;
-			else
-				entry = container->data[entry_index];
-		}
+		entry_index = container->next_entry(entry_index);
 	}
 
 	Object* __HashTable::iterator::get()
@@ -788,13 +826,13 @@ namespace pycpp
 		{
 			char block_location[64];
 			sprintf_s(block_location, "%s::iterator::get",
-				dynamic_cast<Object*>(container)->class_name().c_str());
+				container->as_object()->class_name().c_str());
 
 			__pycpp_error_out_of_bound(block_location);
 			return nullptr;
 		}
 
-		return entry->ref;
+		return container->data[entry_index].ref;
 	}
 
 	#pragma endregion
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../base/object.hpp"
+#include "../base/algo.hpp"
+#include "../base/allocator.hpp"
+#include "../base/collector.hpp"
 #include "iterable.hpp"
 #include "array.hpp"
 #include "deque.hpp"
@@ -10,6 +13,7 @@
 
 namespace pycpp
 {
+
 	class __Array;
 	class __HashTable;
 	class Deque;
@@ -17,49 +21,80 @@ namespace pycpp
 
 #pragma region Declaration : struct Entry
 
+	// Ô của mảng băm, lưu trực tiếp trong mảng ( không cấp phát nút ).
 	struct Entry final
 	{
+		// Chỉ hợp lệ khi byte điều khiển của ô có phần tử.
 		Object* ref;
 		u64 hash_value;
-		Entry* next;
-
-		Entry(Object* ref);
-		Entry(Object* ref, Entry* pointer);
-		Entry(Object* ref, u64 hash_value);
-		Entry(Object* ref, u64 hash_value, Entry* pointer);
-		Entry(Entry&);
-		Entry(Entry&, Entry* pointer);
-
-		Entry(Entry&&) = delete;
-		
-		~Entry();
-
-		// Trả về Object và giảm tham chiếu, xóa Object khỏi Entry.
-		// (!) : chỉ gọi hàm khi Entry còn tham chiếu đến Object.
-		inline Object* pop();
-
 	};
 
 #pragma endregion
 
 #pragma region Declaration : Private HashTable
 
+	/*
+	__HashTable : bảng băm địa chỉ mở kiểu Swiss table.
+
+	- "data" : mảng Entry ( Object*, hash ) liên tục, "control" : mỗi ô một byte điều khiển
+	  ( CONTROL_EMPTY, CONTROL_DELETED, hoặc 7 bit thấp của hash khi ô có phần tử ).
+	- Các ô được chia thành nhóm GROUP_WIDTH ô. Mỗi lần dò kiểm tra cả nhóm byte điều khiển cùng lúc
+	  ( SSE2, hoặc SWAR 64 bit khi không có SSE2 ), chỉ so sánh Object khi byte điều khiển khớp.
+	- Thứ tự dò các nhóm : tam giác ( g, g + 1, g + 3, g + 6 ... ), đi qua mọi nhóm vì số nhóm là lũy thừa của 2.
+	- Vị trí dò và byte điều khiển lấy từ hash đã trộn theo "hash_policy" ( mặc định PYCPP_HASH_POLICY ).
+	- Hệ số tải tối đa 7/8, khi đầy : băm lại tại chỗ nếu nhiều ô đã xóa, ngược lại tăng gấp đôi dung lượng.
+	  Giảm dung lượng khi hệ số tải dưới 7/32 ( trễ : push / pop xen kẽ tại ngưỡng không cấp phát lại liên tục ).
+	- Băm lại tăng dần ( bảng mới từ PYCPP_INCREMENTAL_REHASH_CAPACITY ô ) : bảng cũ và bảng mới cùng tồn tại,
+	  mỗi lần thay đổi / tìm kiếm chuyển PYCPP_REHASH_STEP ô của bảng cũ. Các hàm duyệt toàn bộ bảng
+	  ( iterator, sao chép, các lớp bạn ) gọi "finish_rehash" trước.
+	*/
 	class __HashTable
 	{
 		friend __Array;
 		friend Deque;
 		friend OrderedMap;
 
+		template<u32 Capacity>
+		friend class __FixedArray;
+
 	public:
 		class iterator;
 
 	#pragma region Private HashTable
 
 	protected:
-		Entry** data;
+		static constexpr const u32 GROUP_WIDTH = 16u;
+		static constexpr const u32 MIN_CAPACITY = 4u;
+
+		static constexpr const u8 CONTROL_EMPTY = 0x80u;
+		static constexpr const u8 CONTROL_DELETED = 0xFEu;
+
+		// Byte đệm sau ô cuối cùng khi dung lượng nhỏ hơn GROUP_WIDTH.
+		static constexpr const u8 CONTROL_SENTINEL = 0xFFu;
+
+		u8* control;
+		Entry* data;
 		u32 capacity;
 		u32 len;
 
+		// Số phần tử còn có thể thêm trước khi băm lại ( ô đã xóa không được tính ).
+		u32 growth_left;
+
+		// Vị trí bắt đầu tìm kiếm của "pop".
+		u32 pop_index;
+
+		// Bảng cũ trong lúc băm lại tăng dần, nullptr nếu không băm lại.
+		// Ô đã chuyển sang bảng mới được đánh dấu CONTROL_DELETED.
+		u8* old_control;
+		Entry* old_data;
+		u32 old_capacity;
+
+		// Các ô [0, migrate_index) của bảng cũ đã được chuyển.
+		u32 migrate_index;
+
+		// Cách trộn hash trước khi tính nhóm và byte điều khiển.
+		HashPolicy hash_policy;
+
 		#pragma region Constructors & Destructors
 
 		__HashTable();
@@ -73,10 +108,18 @@ namespace pycpp
 
 		#pragma region Inline Methods
 
-		inline u32 index_hashing(u64 hash_value);
+		// Kiểm tra ô "index" có phần tử.
+		inline bool is_full(u32 index) const { return control[index] < CONTROL_EMPTY; }
+
+		// Số nhóm của mảng băm có dung lượng "n_capacity" ( tối thiểu 1 ).
+		static inline u32 group_count(u32 n_capacity);
 
+		// Dung lượng nhỏ nhất ( lũy thừa của 2 ) đủ chứa "n_len" phần tử.
 		inline u32 find_capacity(u32 n_len);
 
+		// Số phần tử tối đa với dung lượng "n_capacity".
+		inline u32 growth_limit(u32 n_capacity);
+
 
 		// Tìm vị trí Entry đầu tiên có phần tử.
 		// Nếu không tìm thấy, trả về -1.
@@ -91,35 +134,59 @@ namespace pycpp
 		inline i32 last_entry();
 
 
-		// Kiểm tra trong một danh sách liên kết các nút Entry, có tồn tại "item" trong đó hay không.
+		// Tìm vị trí của "item" trong mảng băm ( "table_control", "table_data", "table_capacity" ).
+		// Nếu không tìm thấy, trả về -1.
 		// (!) : hàm không giải phóng bất kì Object nào
-		inline bool exist_in_entry(Entry* head, Object* item, u64 hash_value);
+		inline i32 find_in(const u8* table_control, const Entry* table_data, u32 table_capacity,
+			Object* item, u64 hash_value);
+
+		// Tìm vị trí của "item" trong bảng mới, nếu không tìm thấy, trả về -1.
+		inline i32 find_index(Object* item, u64 hash_value);
+
+		// Tìm "item" trong bảng mới và bảng cũ, trả về Object trong bảng ( nullptr nếu không tồn tại ).
+		inline Object* find_object(Object* item, u64 hash_value);
 
+		// Tìm ô trống ( hoặc đã xóa ) đầu tiên trên đường dò của "hash_value".
+		// (!) : mảng băm phải còn ô trống
+		inline u32 find_insert_index(u64 hash_value);
 
-		// Tăng dung lượng mảng lên capacity = 3.
-		inline void grow_when_empty();
+		// Gán byte điều khiển và Entry cho ô "index", nhận luôn tham chiếu của "item".
+		// (!) : hàm không kiểm tra tồn tại và không thay đổi dung lượng
+		inline void insert_at(u32 index, Object* item, u64 hash_value);
 
-		// Giảm dung lượng mảng về 0.
-		// Yêu cầu : capacity = 3, và len = 0 hoặc len = 1.
-		inline void shrink_to_empty();
+		// Xóa phần tử tại ô "index", trả về Object ( không giảm tham chiếu ).
+		inline Object* erase_at(u32 index);
 
 
-		// Mở rộng từ danh sách.
-		// (!) : hàm không thay đổi mảng băm
-		inline void only_extend(std::initializer_list<Object*>);
+		// Cấp phát mảng băm rỗng với dung lượng "n_capacity".
+		// (!) : hàm không giải phóng mảng cũ
+		inline void allocate(u32 n_capacity);
 
 		#pragma endregion
 
 		#pragma region Allocation
 
-		// Tăng dung lượng mảng
+		// Băm lại toàn bộ phần tử vào mảng băm có dung lượng "n_capacity".
+		// Tăng dần nếu "n_capacity" đủ lớn, khi đó hàm chỉ chuyển PYCPP_REHASH_STEP ô.
+		void rehash(u32 n_capacity);
+
+		// Chuyển tối đa "budget" ô của bảng cũ sang bảng mới, giải phóng bảng cũ khi đã chuyển hết.
+		void rehash_step(u32 budget);
+
+		// Hoàn tất băm lại tăng dần ( nếu có ).
+		void finish_rehash();
+
+		// Đổi cách trộn hash, băm lại toàn bộ phần tử với dung lượng hiện tại.
+		void set_hash_policy(HashPolicy policy);
+
+		// Tăng dung lượng mảng ( hoặc băm lại tại chỗ nếu nhiều ô đã xóa )
 		void grow();
 
 		// Giảm dung lượng mảng
 		void shrink();
 
-		// Thay đổi dung lượng mảng băm phù hợp với "n_len"
-		// (!) : hàm không xóa phần tử, "n_len" == 0 không hợp lệ
+		// Tăng dung lượng mảng băm đủ chứa "n_len" phần tử
+		// (!) : hàm không xóa phần tử, không giảm dung lượng
 		void resize_based_on_len(u32 n_len);
 
 		#pragma endregion
@@ -141,6 +208,9 @@ namespace pycpp
 
 		bool push(Object*);
 		Object* pop();
+
+		// Tương tự "push" nhưng nhận luôn tham chiếu của người gọi ( không INREF ).
+		bool push_steal(Object*);
 		
 
 		void extend(Iterable*);
@@ -150,28 +220,28 @@ namespace pycpp
 
 		#pragma region Private Methods
 
-		// Liên kết toàn bộ Entry, trả về nút đầu của danh sách.
-		// (!) : trả về nullptr nếu "this" rỗng.
-		Entry* connect_entry();
-
-		// Tái cấu trúc danh sách liên kết Entry.
-		void restructure(Entry* head);
-
 		bool contains(Object* elem, u64 hash_value);
 
 		bool push(Object*, u64 hash_value);
+		bool push_steal(Object*, u64 hash_value);
 
 
 		void extend_from_array(__Array* source);
 		void extend_from_hashtable(__HashTable* source);
 		void extend_from_iterable(Iterable* iterable);
 
+		// Gọi "visit" với mỗi phần tử.
+		void traverse(TraverseVisitor visit, void* context);
+
 		#pragma endregion
 
 	#pragma endregion
 
 	public:
 
+		// Trả về Object triển khai __HashTable ( không tăng tham chiếu ).
+		virtual Object* as_object();
+
 	#pragma region Iterator
 
 		class iterator final : public Iterator, public Object
@@ -179,16 +249,20 @@ namespace pycpp
 			friend __HashTable;
 
 			__HashTable* container;
+
+			// Vị trí ô hiện tại, -1 : kết thúc.
 			i32 entry_index;
-			Entry* entry;
 
-			iterator(__HashTable* container, i32 entry_index, bool first=true);
+			iterator(__HashTable* container, i32 entry_index);
 		public:
-			TYPE_ID(__HashTable::iterator);
+			~iterator();
+
+			BUILTIN_TYPE_ID(HashTableIterator);
 
 			///==========     Override Object     ==========///
 
 			i64 type() override;
+			Object* as_object() override;
 			std::string class_name() override;
 			u32 bytes() override;
 
@@ -0,0 +1,533 @@
+#include "reduce.hpp"
+#include "array.hpp"
+#include "arraylist.hpp"
+#include "../base/error.hpp"
+
+#include <type_traits>
+
+// #define _CRT_SECURE_NO_WARNINGS
+#pragma warning(disable : 4996)
+
+namespace pycpp
+{
+
+#pragma region Definition : Numeric Sequence
+
+	template <typename T>
+	static inline void numeric_sequence_of_typed(__NumericSequence& sequence, TypedArray<T>* typed)
+	{
+		sequence.kind = type_index_of(__TypedArrayTraits<T>::Box::type_id);
+		sequence.values = typed->raw();
+		sequence.len = typed->size();
+	}
+
+	__NumericSequence __NumericSequence::from(Iterable* iterable)
+	{
+		__NumericSequence sequence;
+
+		switch (iterable->type_index())
+		{
+		case TypeIndex::I32Array:
+			numeric_sequence_of_typed(sequence, static_cast<I32Array*>(iterable));
+			return sequence;
+
+		case TypeIndex::I64Array:
+			numeric_sequence_of_typed(sequence, static_cast<I64Array*>(iterable));
+			return sequence;
+
+		case TypeIndex::F32Array:
+			numeric_sequence_of_typed(sequence, static_cast<F32Array*>(iterable));
+			return sequence;
+
+		case TypeIndex::F64Array:
+			numeric_sequence_of_typed(sequence, static_cast<F64Array*>(iterable));
+			return sequence;
+
+		default:
+			break;
+		}
+
+		auto __array = as_array(iterable);
+		if (__array == nullptr || __array->len == 0u)
+			return sequence;
+
+		auto kind = __array->data[0]->type_index();
+		switch (kind)
+		{
+		case TypeIndex::I32:
+		case TypeIndex::I64:
+		case TypeIndex::F32:
+		case TypeIndex::F64:
+			break;
+
+		default:
+			return sequence;
+		}
+
+		// Đọc TypeIndex trong header, không gọi hàm ảo
+		for (u32 i = 1u; i < __array->len; ++i)
+			if (__array->data[i]->type_index() != kind)
+				return sequence;
+
+		sequence.kind = kind;
+		sequence.boxes = __array->data;
+		sequence.len = __array->len;
+		return sequence;
+	}
+
+#pragma endregion
+
+#pragma region Kernels
+
+	// Số nguyên tích lũy trên u64 ( quay vòng như khi cộng từng Object ), số thực trên f64.
+	template <typename V>
+	using __accumulate_t = std::conditional_t<std::is_floating_point_v<V>, f64, u64>;
+
+	template <typename V>
+	using __box_t = typename __TypedArrayTraits<V>::Box;
+
+	template <typename Acc, typename Load>
+	static Acc kernel_sum(Load load, u32 len)
+	{
+		Acc s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+		u32 i = 0u;
+
+		// 4 biến tích lũy độc lập : không phụ thuộc dữ liệu giữa các phép cộng liên tiếp
+		for (; i + 4u <= len; i += 4u)
+		{
+			s0 += Acc(load(i));
+			s1 += Acc(load(i + 1u));
+			s2 += Acc(load(i + 2u));
+			s3 += Acc(load(i + 3u));
+		}
+
+		for (; i < len; ++i)
+			s0 += Acc(load(i));
+
+		return (s0 + s1) + (s2 + s3);
+	}
+
+	template <typename LoadA, typename LoadB>
+	static Object* kernel_dot(LoadA load_a, LoadB load_b, u32 len)
+	{
+		// Kiểu kết quả giống I32 * F32 -> F32 ...
+		using R = decltype(typename LoadA::value_type() * typename LoadB::value_type());
+		using Acc = __accumulate_t<R>;
+
+		Acc s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+		u32 i = 0u;
+
+		for (; i + 4u <= len; i += 4u)
+		{
+			s0 += Acc(load_a(i)) * Acc(load_b(i));
+			s1 += Acc(load_a(i + 1u)) * Acc(load_b(i + 1u));
+			s2 += Acc(load_a(i + 2u)) * Acc(load_b(i + 2u));
+			s3 += Acc(load_a(i + 3u)) * Acc(load_b(i + 3u));
+		}
+
+		for (; i < len; ++i)
+			s0 += Acc(load_a(i)) * Acc(load_b(i));
+
+		return __box_t<R>::from(R((s0 + s1) + (s2 + s3)));
+	}
+
+	// Vị trí phần tử nhỏ nhất ( Greater = false ) hoặc lớn nhất ( Greater = true ), phần tử đầu tiên nếu bằng nhau.
+	// Điều kiện : len > 0.
+	template <bool Greater, typename Load>
+	static u32 kernel_arg(Load load, u32 len)
+	{
+		using V = typename Load::value_type;
+
+		auto better = [](V a, V b) { return Greater ? b < a : a < b; };
+
+		// Giống so sánh từng Object : NaN không lớn / nhỏ hơn giá trị nào, NaN ở đầu giữ nguyên vị trí 0
+		V first = load(0u);
+		if (first != first)
+			return 0u;
+
+		V best[4] = { first, first, first, first };
+		u32 index[4] = { 0u, 0u, 0u, 0u };
+		u32 i = 1u;
+
+		for (; i + 4u <= len; i += 4u)
+			for (u32 lane = 0u; lane < 4u; ++lane)
+			{
+				V value = load(i + lane);
+				if (better(value, best[lane]))
+				{
+					best[lane] = value;
+					index[lane] = i + lane;
+				}
+			}
+
+		for (; i < len; ++i)
+		{
+			V value = load(i);
+			if (better(value, best[0]))
+			{
+				best[0] = value;
+				index[0] = i;
+			}
+		}
+
+		// Gộp các làn : giá trị tốt hơn, hoặc bằng nhau nhưng đứng trước
+		u32 result = 0u;
+		for (u32 lane = 1u; lane < 4u; ++lane)
+			if (better(best[lane], best[result]) ||
+				(!better(best[result], best[lane]) && index[lane] < index[result]))
+				result = lane;
+
+		return index[result];
+	}
+
+#pragma endregion
+
+#pragma region Generic
+
+	// Giải phóng "iterable" nếu là Object tạm ( đã INREF khi bắt đầu ),
+	// giữ "result" sống qua lần giải phóng đó ( "result" có thể là phần tử của "iterable" ).
+	static inline Object* release_result(Object* result, Iterable* iterable)
+	{
+		INREF(result);
+		DECREF(iterable);
+		DEREF(result);
+		return result;
+	}
+
+	// Trả lại tham chiếu đã INREF của "iterable" rồi ném lỗi.
+	static void error_empty(const char* block_location, Iterable* iterable)
+	{
+		auto __class_name = iterable->class_name();
+		DECREF(iterable);
+		__pycpp_error_retrieve_from_empty_container(block_location, __class_name.c_str());
+	}
+
+	// Cộng dồn bằng "add", trả về nullptr nếu rỗng. Không SAFE(iterable).
+	static Object* generic_sum(Iterable* iterable)
+	{
+		Object* result = nullptr;
+		auto iter = iterable->first();
+
+		for (; iter->is_valid(); iter->next())
+		{
+			auto cur = iter->get();
+			if (result == nullptr)
+			{
+				result = cur;
+				INREF(result);
+				continue;
+			}
+
+			auto next = result->add(cur);
+			INREF(next);
+			DECREF(result);
+			result = next;
+		}
+
+		SAFE(iter);
+		if (result)
+			DEREF(result);
+		return result;
+	}
+
+	// Vị trí phần tử nhỏ nhất / lớn nhất bằng "rich_compare", "result" nhận phần tử đó. Không SAFE(iterable).
+	template <bool Greater>
+	static u32 generic_arg(Iterable* iterable, Object*& result, const char* block_location)
+	{
+		Object* best = nullptr;
+		u32 best_index = 0u, index = 0u;
+		auto iter = iterable->first();
+
+		for (; iter->is_valid(); iter->next(), ++index)
+		{
+			auto cur = iter->get();
+			if (best == nullptr)
+			{
+				best = cur;
+				INREF(best);
+				continue;
+			}
+
+			i32 compare = cur->rich_compare(best);
+			if (Greater ? compare > 0 : compare < 0)
+			{
+				INREF(cur);
+				DECREF(best);
+				best = cur;
+				best_index = index;
+			}
+		}
+
+		SAFE(iter);
+		if (best == nullptr)
+			error_empty(block_location, iterable);
+
+		DEREF(best);
+		result = best;
+		return best_index;
+	}
+
+	template <bool Greater>
+	static Object* reduce_extreme(Iterable* iterable, const char* block_location)
+	{
+		INREF(iterable);
+		auto sequence = __NumericSequence::from(iterable);
+		if (sequence.is_homogeneous() == false)
+		{
+			Object* result;
+			generic_arg<Greater>(iterable, result, block_location);
+			return release_result(result, iterable);
+		}
+
+		if (sequence.len == 0u)
+			error_empty(block_location, iterable);
+
+		auto index = __numeric_dispatch(sequence, [&](auto load) { return kernel_arg<Greater>(load, sequence.len); });
+
+		// Mảng Object : trả về chính phần tử, không cấp phát
+		Object* result;
+		if (sequence.boxes)
+			result = sequence.boxes[index];
+		else
+			result = __numeric_dispatch(sequence, [&](auto load) -> Object*
+				{
+					using V = typename decltype(load)::value_type;
+					return __box_t<V>::from(load(index));
+				});
+
+		return release_result(result, iterable);
+	}
+
+	template <bool Greater>
+	static u32 reduce_arg(Iterable* iterable, const char* block_location)
+	{
+		INREF(iterable);
+		auto sequence = __NumericSequence::from(iterable);
+		u32 index;
+
+		if (sequence.is_homogeneous() == false)
+		{
+			Object* result;
+			index = generic_arg<Greater>(iterable, result, block_location);
+			SAFE(result);
+		}
+		else
+		{
+			if (sequence.len == 0u)
+				error_empty(block_location, iterable);
+
+			index = __numeric_dispatch(sequence, [&](auto load) { return kernel_arg<Greater>(load, sequence.len); });
+		}
+
+		DECREF(iterable);
+		return index;
+	}
+
+#pragma endregion
+
+#pragma region Definition : Reduction
+
+	Object* sum(Iterable* iterable)
+	{
+		// Iterator giữ tham chiếu đến "iterable" : INREF trước để Object tạm không bị giải phóng khi Iterator bị hủy
+		INREF(iterable);
+		auto sequence = __NumericSequence::from(iterable);
+		Object* result;
+
+		if (sequence.is_homogeneous() && sequence.len != 0u)
+		{
+			result = __numeric_dispatch(sequence, [&](auto load) -> Object*
+				{
+					using V = typename decltype(load)::value_type;
+					return __box_t<V>::from(V(kernel_sum<__accumulate_t<V>>(load, sequence.len)));
+				});
+		}
+		else
+		{
+			result = generic_sum(iterable);
+			if (result == nullptr)
+				result = I32::from(0);
+		}
+
+		return release_result(result, iterable);
+	}
+
+	Object* min(Iterable* iterable)
+	{
+		return reduce_extreme<false>(iterable, "min(Iterable)");
+	}
+
+	Object* max(Iterable* iterable)
+	{
+		return reduce_extreme<true>(iterable, "max(Iterable)");
+	}
+
+	u32 argmin(Iterable* iterable)
+	{
+		return reduce_arg<false>(iterable, "argmin(Iterable)");
+	}
+
+	u32 argmax(Iterable* iterable)
+	{
+		return reduce_arg<true>(iterable, "argmax(Iterable)");
+	}
+
+	Object* mean(Iterable* iterable)
+	{
+		INREF(iterable);
+		auto sequence = __NumericSequence::from(iterable);
+		f64 total = 0.0;
+		u32 count;
+
+		if (sequence.is_homogeneous())
+		{
+			count = sequence.len;
+			if (count != 0u)
+				total = __numeric_dispatch(sequence, [&](auto load) { return kernel_sum<f64>(load, count); });
+		}
+		else
+		{
+			count = iterable->size();
+			if (count != 0u)
+				total = F64::init_from_object(generic_sum(iterable));
+		}
+
+		if (count == 0u)
+			error_empty("mean(Iterable)", iterable);
+
+		DECREF(iterable);
+		return F64::from(total / f64(count));
+	}
+
+	Object* dot(Iterable* a, Iterable* b)
+	{
+		INREF(a);
+		INREF(b);
+		auto sequence_a = __NumericSequence::from(a);
+		auto sequence_b = __NumericSequence::from(b);
+		Object* result = nullptr;
+		bool same_size;
+
+		if (sequence_a.is_homogeneous() && sequence_b.is_homogeneous())
+		{
+			same_size = sequence_a.len == sequence_b.len;
+			if (same_size)
+				result = sequence_a.len == 0u ? I32::from(0) :
+					__numeric_dispatch(sequence_a, [&](auto load_a)
+						{
+							return __numeric_dispatch(sequence_b, [&](auto load_b)
+								{
+									return kernel_dot(load_a, load_b, sequence_a.len);
+								});
+						});
+		}
+		else
+		{
+			auto iter_a = a->first();
+			auto iter_b = b->first();
+
+			for (; iter_a->is_valid() && iter_b->is_valid(); iter_a->next(), iter_b->next())
+			{
+				auto product = iter_a->get()->mul(iter_b->get());
+				if (result == nullptr)
+				{
+					result = product;
+					INREF(result);
+					continue;
+				}
+
+				auto next = result->add(product);
+				INREF(next);
+				DECREF(result);
+				result = next;
+			}
+
+			same_size = iter_a->is_valid() == iter_b->is_valid();
+			SAFE(iter_a);
+			SAFE(iter_b);
+
+			if (result)
+				DEREF(result);
+			else
+				result = I32::from(0);
+		}
+
+		if (same_size == false)
+		{
+			if (result)
+				SAFE(result);
+
+			char content_error[128];
+			std::sprintf(content_error,
+				"Error in dot(Iterable, Iterable) : %s and %s must have the same size !",
+				a->class_name().c_str(), b->class_name().c_str());
+
+			DECREF(a);
+			DECREF(b);
+			std::cout << content_error << std::endl;
+			throw std::exception("Error : the number of elements of two Iterables must be equal !");
+		}
+
+		INREF(result);
+		DECREF(a);
+		DECREF(b);
+		DEREF(result);
+		return result;
+	}
+
+	List* prefix_sum(Iterable* iterable)
+	{
+		INREF(iterable);
+		auto sequence = __NumericSequence::from(iterable);
+		List* result;
+
+		if (sequence.is_homogeneous())
+		{
+			result = __numeric_dispatch(sequence, [&](auto load) -> List*
+				{
+					using V = typename decltype(load)::value_type;
+					__accumulate_t<V> total = 0;
+
+					auto typed = new TypedArray<V>();
+					typed->reserve(sequence.len);
+					for (u32 i = 0u; i < sequence.len; ++i)
+					{
+						total += __accumulate_t<V>(load(i));
+						typed->push_value(V(total));
+					}
+
+					return typed;
+				});
+		}
+		else
+		{
+			auto list = new ArrayList();
+			Object* total = nullptr;
+			auto iter = iterable->first();
+
+			for (; iter->is_valid(); iter->next())
+			{
+				auto cur = iter->get();
+				auto next = total == nullptr ? cur : total->add(cur);
+
+				INREF(next);
+				if (total)
+					DECREF(total);
+				total = next;
+
+				list->push(total);
+			}
+
+			SAFE(iter);
+			if (total)
+				DECREF(total);
+			result = list;
+		}
+
+		DECREF(iterable);
+		return result;
+	}
+
+#pragma endregion
+
+}
\ No newline at end of file
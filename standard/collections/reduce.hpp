@@ -0,0 +1,142 @@
+#pragma once
+
+#include "../base/object.hpp"
+#include "../base/primitive.hpp"
+#include "iterable.hpp"
+#include "typedarray.hpp"
+
+#include <type_traits>
+
+namespace pycpp
+{
+
+#pragma region Declaration : Numeric Sequence
+
+	/*
+	Numeric Sequence : dãy số đồng nhất, đọc giá trị trực tiếp thay vì gọi hàm ảo trên từng Object.
+
+	- TypedArray : đọc thẳng từ "raw()".
+	- __Array ( ArrayList, Tuple ) mà mọi phần tử cùng là I32, I64, F32 hoặc F64 : đọc "value" của từng Object.
+	- Các trường hợp khác ( Boolean, trộn nhiều kiểu, Deque, Iterable của người dùng ... ) : "kind" là Unknown,
+	  hàm gọi nó quay về cách tổng quát ( add / mul / rich_compare ).
+	*/
+
+	struct __NumericSequence
+	{
+		// I32, I64, F32, F64 hoặc Unknown nếu không đồng nhất.
+		TypeIndex kind = TypeIndex::Unknown;
+
+		// Một trong hai khác nullptr.
+		const void* values = nullptr;
+		Object** boxes = nullptr;
+
+		u32 len = 0u;
+
+		// Kiểm tra "iterable" ( một lần duyệt với __Array ), không SAFE(iterable).
+		static __NumericSequence from(Iterable* iterable);
+
+		inline bool is_homogeneous() const
+		{
+			return kind != TypeIndex::Unknown;
+		}
+	};
+
+	// Đọc phần tử từ mảng giá trị.
+	template <typename T>
+	struct __ValueLoader
+	{
+		using value_type = T;
+		const T* values;
+
+		inline T operator()(u32 index) const
+		{
+			return values[index];
+		}
+	};
+
+	// Đọc phần tử từ mảng Object cùng kiểu "Box".
+	template <typename Box>
+	struct __BoxLoader
+	{
+		using value_type = std::remove_const_t<decltype(Box::value)>;
+		Object** boxes;
+
+		inline value_type operator()(u32 index) const
+		{
+			return static_cast<const Box*>(boxes[index])->value;
+		}
+	};
+
+	// Gọi "function(loader)" với loader tương ứng kiểu của "sequence".
+	// (!) : chỉ gọi khi "sequence" đồng nhất.
+	template <typename Function>
+	inline auto __numeric_dispatch(const __NumericSequence& sequence, Function&& function)
+	{
+		switch (sequence.kind)
+		{
+		case TypeIndex::I32:
+			return sequence.values ?
+				function(__ValueLoader<i32>{ static_cast<const i32*>(sequence.values) }) :
+				function(__BoxLoader<I32>{ sequence.boxes });
+
+		case TypeIndex::I64:
+			return sequence.values ?
+				function(__ValueLoader<i64>{ static_cast<const i64*>(sequence.values) }) :
+				function(__BoxLoader<I64>{ sequence.boxes });
+
+		case TypeIndex::F32:
+			return sequence.values ?
+				function(__ValueLoader<f32>{ static_cast<const f32*>(sequence.values) }) :
+				function(__BoxLoader<F32>{ sequence.boxes });
+
+		default:
+			return sequence.values ?
+				function(__ValueLoader<f64>{ static_cast<const f64*>(sequence.values) }) :
+				function(__BoxLoader<F64>{ sequence.boxes });
+		}
+	}
+
+#pragma endregion
+
+#pragma region Declaration : Reduction
+
+	/*
+	Reduction : các phép gộp trên Iterable chứa số.
+
+	- Dãy đồng nhất ( xem __NumericSequence ) : vòng lặp mở rộng 4 lần với 4 biến tích lũy độc lập,
+	  không cấp phát Object trung gian, trình biên dịch có thể vector hóa ( không dùng intrinsic ).
+	- Các trường hợp khác : gộp lần lượt bằng "add" / "mul" / "rich_compare" của Object.
+	- Kiểu kết quả theo quy tắc của primitive.hpp ( I32 + I32 -> I32 ... ), số nguyên tràn số được quay vòng
+	  như khi cộng từng Object. Với số thực, thứ tự cộng khác nên kết quả có thể lệch ở các bit cuối.
+	- Object trả về có thể là Object tạm hoặc một phần tử của "iterable" : cần SAFE hoặc gán vào var.
+	- "iterable" là Object tạm sẽ được giải phóng sau khi gọi ( giống "extend" ).
+	*/
+
+	// Tổng các phần tử, I32(0) nếu rỗng.
+	Object* sum(Iterable* iterable);
+
+	// Phần tử nhỏ nhất ( phần tử đầu tiên nếu có nhiều ), ném lỗi nếu rỗng.
+	Object* min(Iterable* iterable);
+
+	// Phần tử lớn nhất ( phần tử đầu tiên nếu có nhiều ), ném lỗi nếu rỗng.
+	Object* max(Iterable* iterable);
+
+	// Vị trí của phần tử nhỏ nhất, ném lỗi nếu rỗng.
+	u32 argmin(Iterable* iterable);
+
+	// Vị trí của phần tử lớn nhất, ném lỗi nếu rỗng.
+	u32 argmax(Iterable* iterable);
+
+	// Trung bình cộng ( F64 ), ném lỗi nếu rỗng.
+	Object* mean(Iterable* iterable);
+
+	// Tổng các tích a[i] * b[i], ném lỗi nếu hai dãy khác độ dài.
+	Object* dot(Iterable* a, Iterable* b);
+
+	// Dãy tổng tiền tố : result[i] = a[0] + ... + a[i].
+	// Dãy đồng nhất cho ra TypedArray cùng kiểu phần tử, còn lại cho ra ArrayList.
+	List* prefix_sum(Iterable* iterable);
+
+#pragma endregion
+
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "tuple.hpp"
 #include "../base/algo.hpp"
+#include "../base/intern.hpp"
 
 namespace pycpp
 {
@@ -21,6 +22,12 @@ namespace pycpp
 	Tuple::Tuple(Iterable* iterable) :
 		__Array(iterable), hash_value(pycpp::hash_array(data, len)) {}
 
+	Tuple::~Tuple()
+	{
+		if (is_interned())
+			intern_discard(this);
+	}
+
 		#pragma endregion
 
 		#pragma region Override : Object
@@ -30,6 +37,11 @@ namespace pycpp
 		return Tuple::type_id;
 	}
 
+	Object* Tuple::as_object()
+	{
+		return this;
+	}
+
 	std::string Tuple::class_name()
 	{
 		return "Tuple";
@@ -40,6 +52,17 @@ namespace pycpp
 		return hash_value;
 	}
 
+	void Tuple::traverse(TraverseVisitor visit, void* context)
+	{
+		__Array::traverse(visit, context);
+	}
+
+	void Tuple::clear_references()
+	{
+		// Chỉ được gọi bởi bộ thu gom với Tuple là rác
+		__Array::clear();
+	}
+
 	u32 Tuple::bytes()
 	{
 		u32 size_of_class = sizeof(Tuple);
@@ -67,11 +90,14 @@ namespace pycpp
 
 	bool Tuple::equal(Object* other)
 	{
-		auto __array = dynamic_cast<__Array*>(other);
+		if (this == other)
+			return true;
+
+		auto __array = as_array(other);
 		if (__array)
 			return __Array::equal(__array);
 
-		auto arguments = dynamic_cast<Arguments*>(other);
+		auto arguments = as_arguments(other);
 		if (arguments)
 			return Arguments::equal(arguments);
 
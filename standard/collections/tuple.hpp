@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../base/allocator.hpp"
 #include "array.hpp"
 
 namespace pycpp
@@ -9,12 +10,18 @@ namespace pycpp
 
 	class Tuple final : public Iterable, public Arguments, public __Array
 	{
+		// Thay phần tử bằng bản chuẩn khi intern Tuple.
+		friend Object* __intern_object(Object* object, bool shared);
 
 	#pragma region Tuple
 		const u64 hash_value;
 
+		// Được theo dõi bởi bộ thu gom chu trình.
+		__GCNode gc_node{ this };
+
 	public:
-		TYPE_ID(Tuple);
+		BUILTIN_TYPE_ID(Tuple);
+		SLAB_ALLOCATOR(Tuple);
 
 		#pragma region Constructors & Destructors
 
@@ -23,18 +30,21 @@ namespace pycpp
 		Tuple(const Tuple&);
 		Tuple(std::initializer_list<Object*>);
 
-		~Tuple() = default;
+		~Tuple();
 
 		#pragma endregion
 
 		#pragma region Override : Object
 
 		i64 type() override;
+		Object* as_object() override;
 		std::string class_name() override;
 		void output() override;
 		void output(std::string& out) override;
 		u64 hash() override;
 		u32 bytes() override;
+		void traverse(TraverseVisitor visit, void* context) override;
+		void clear_references() override;
 
 		bool equal(Object*) override;
 
@@ -0,0 +1,828 @@
+#include "typedarray.hpp"
+#include "array.hpp"
+#include "../base/algo.hpp"
+#include "../base/error.hpp"
+#include "../base/numeric.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+// #define _CRT_SECURE_NO_WARNINGS
+#pragma warning(disable : 4996)
+
+namespace pycpp
+{
+
+#pragma region Definition : Typed Array
+
+	#pragma region Constructors & Destructor
+
+	template <typename T>
+	TypedArray<T>::TypedArray() : data(nullptr), capacity_of_data(0u), len(0u) {}
+
+	template <typename T>
+	TypedArray<T>::TypedArray(std::initializer_list<T> list) : TypedArray()
+	{
+		extend_values(list.begin(), u32(list.size()));
+	}
+
+	template <typename T>
+	TypedArray<T>::TypedArray(const T* values, u32 count) : TypedArray()
+	{
+		extend_values(values, count);
+	}
+
+	template <typename T>
+	TypedArray<T>::TypedArray(TypedArray& source) : TypedArray()
+	{
+		extend_values(source.data, source.len);
+	}
+
+	template <typename T>
+	TypedArray<T>::TypedArray(Iterable* iterable) : TypedArray()
+	{
+		extend(iterable);	// Don't need SAFE(iterable)
+	}
+
+	template <typename T>
+	TypedArray<T>::~TypedArray()
+	{
+		delete[] data;
+	}
+
+	#pragma endregion
+
+	#pragma region Override Object
+
+	template <typename T>
+	i64 TypedArray<T>::type()
+	{
+		return type_id;
+	}
+
+	template <typename T>
+	Object* TypedArray<T>::as_object()
+	{
+		return this;
+	}
+
+	template <typename T>
+	std::string TypedArray<T>::class_name()
+	{
+		return Traits::name;
+	}
+
+	template <typename T>
+	void TypedArray<T>::output()
+	{
+		std::string content;
+		output(content);
+		std::cout << content;
+	}
+
+	template <typename T>
+	void TypedArray<T>::output(std::string& out)
+	{
+		out = "[";
+		for (u32 i = 0u; i < len; ++i)
+		{
+			if (i != 0u)
+				out += ", ";
+			out += std::to_string(data[i]);
+		}
+		out += "]";
+	}
+
+	template <typename T>
+	u64 TypedArray<T>::hash()
+	{
+		// Giống "hash_array" trên các giá trị đã đóng hộp
+		if (len == 0u)
+			return HASH_ARRAY_BASE;
+
+		u64 hash_value = 0u;
+		for (u32 i = 0u; i < len; ++i)
+			hash_value = hash_array_combine(hash_value, hash_finalize(Traits::hash(data[i]), PYCPP_HASH_POLICY));
+
+		return hash_value;
+	}
+
+	template <typename T>
+	u32 TypedArray<T>::bytes()
+	{
+		return sizeof(TypedArray<T>) + sizeof(T) * capacity_of_data;
+	}
+
+	template <typename T>
+	Object* TypedArray<T>::copy()
+	{
+		return new TypedArray<T>(*this);
+	}
+
+
+	template <typename T>
+	bool TypedArray<T>::equal(Object* other)
+	{
+		auto arguments = as_arguments(other);
+		if (arguments == nullptr)
+			return false;
+
+		return equal(arguments);
+	}
+
+	template <typename T>
+	i32 TypedArray<T>::rich_compare(Object* other)
+	{
+		auto arguments = as_arguments(other);
+		if (arguments == nullptr)
+		{
+			char content_error[128];
+			sprintf_s(content_error,
+				"Error in %s::rich_compare : "
+				"the compare operator cannot be used to compare %s with %s !",
+				Traits::name, Traits::name, other->class_name().c_str());
+
+			std::cout << content_error << std::endl;
+			throw std::exception("Error: comparing TypedArray with a different data type other than Arguments");
+
+			return 0;
+		}
+
+		return rich_compare(arguments);
+	}
+
+
+	template <typename T>
+	Object* TypedArray<T>::add(Object* other)
+	{
+		auto iterable = as_iterable(other);
+		if (iterable == nullptr)
+		{
+			char content_error[128];
+			std::sprintf(content_error,
+				"Error in %s::add : the add operator cannot be used"
+				"to add %s with %s !",
+				Traits::name, Traits::name, other->class_name().c_str());
+
+			std::cout << content_error << std::endl;
+			throw std::exception("Error : cannot concatenate a TypedArray with an Object that is not Iterable!");
+
+			return nullptr;
+		}
+
+		extend(iterable);
+		// Don't need to SAFE "iterable"
+		return this;
+	}
+
+	template <typename T>
+	Object* TypedArray<T>::mul(Object* other)
+	{
+		i64 other_type = other->type();
+		i32 num;
+
+		switch (other_type)
+		{
+		case I32::type_id:
+			num = static_cast<I32*>(other)->value;
+			break;
+
+		case I64::type_id:
+			num = (i32) static_cast<I64*>(other)->value;
+			break;
+
+		default:
+		{
+			char content_error[128];
+			std::sprintf(content_error,
+				"Error in %s::mul : the mul operator cannot be used"
+				"to multiply %s with %s !",
+				Traits::name, Traits::name, other->class_name().c_str());
+
+			std::cout << content_error << std::endl;
+			throw std::exception("Error : operator with invalid data type");
+		}
+		}
+
+		// Error : multiplying TypedArray with by a negative number
+		if (num < 0)
+		{
+			char content_error[128];
+			std::sprintf(content_error,
+				"Error in %s::mul : the mul operator cannot be used"
+				"to multiply %s with negative number of %s !",
+				Traits::name, Traits::name, other->class_name().c_str());
+
+			std::cout << content_error << std::endl;
+			throw std::exception("Error : multiplying a list by a negative number");
+		}
+
+		multiply_with_int(u32(num));
+
+		SAFE(other);
+		return this;
+	}
+
+	#pragma endregion
+
+	#pragma region Override Iterable
+
+	template <typename T>
+	Iterator* TypedArray<T>::first()
+	{
+		return new iterator(this, 0);
+	}
+
+	template <typename T>
+	Iterator* TypedArray<T>::last()
+	{
+		return new iterator(this, i32(len) - 1);
+	}
+
+	#pragma endregion
+
+	#pragma region Override Arguments
+
+	template <typename T>
+	bool TypedArray<T>::is_empty()
+	{
+		return len == 0u;
+	}
+
+	template <typename T>
+	u32 TypedArray<T>::size()
+	{
+		return len;
+	}
+
+	template <typename T>
+	Object* TypedArray<T>::get(i32 index)
+	{
+		return Box::from(get_value(index));
+	}
+
+	template <typename T>
+	bool TypedArray<T>::equal(Arguments* arguments)
+	{
+		auto object = arguments->as_object();
+		if (object == this)
+			return true;
+
+		auto typed = OBJECT_CAST<TypedArray<T>>(object);
+		if (typed)
+			return equal_with_typed(typed);
+
+		if (len != arguments->size())
+		{
+			SAFE(arguments);
+			return false;
+		}
+
+		for (u32 i = 0u; i < len; ++i)
+		{
+			// Đóng hộp trên stack, "equal" giải phóng phần tử tạm của "arguments"
+			Box boxed(data[i]);
+			if (boxed.equal(arguments->get(i)) == false)
+			{
+				SAFE(arguments);
+				return false;
+			}
+		}
+
+		SAFE(arguments);
+		return true;
+	}
+
+	template <typename T>
+	i32 TypedArray<T>::rich_compare(Arguments* arguments)
+	{
+		auto object = arguments->as_object();
+		if (object == this)
+			return 0;
+
+		auto typed = OBJECT_CAST<TypedArray<T>>(object);
+		if (typed)
+			return rich_compare_with_typed(typed);
+
+		auto other_len = arguments->size();
+		auto min_len = pycpp::min(len, other_len);
+
+		for (u32 i = 0u; i < min_len; ++i)
+		{
+			Box boxed(data[i]);
+			i32 result = boxed.rich_compare(arguments->get(i));
+
+			if (result != 0)
+			{
+				SAFE(arguments);
+				return result;
+			}
+		}
+
+		SAFE(arguments);
+		return i32(len) - i32(other_len);
+	}
+
+	#pragma endregion
+
+	#pragma region Override Container
+
+	template <typename T>
+	void TypedArray<T>::clear()
+	{
+		delete[] data;
+		data = nullptr;
+		capacity_of_data = len = 0u;
+	}
+
+	template <typename T>
+	bool TypedArray<T>::contains(Object* item)
+	{
+		bool result = false;
+
+		if (item->type_index() == type_index_of(Box::type_id))
+		{
+			// Cùng kiểu với phần tử : so sánh trực tiếp
+			T value = static_cast<Box*>(item)->value;
+			for (u32 i = 0u; i < len; ++i)
+				if (data[i] == value)
+				{
+					result = true;
+					break;
+				}
+		}
+		else if (is_numeric(item))
+		{
+			for (u32 i = 0u; i < len; ++i)
+			{
+				Box boxed(data[i]);
+				if (numeric_equal(&boxed, item))
+				{
+					result = true;
+					break;
+				}
+			}
+		}
+
+		SAFE(item);
+		return result;
+	}
+
+	template <typename T>
+	bool TypedArray<T>::push(Object* item)
+	{
+		push_value(Box::init_from_object(item));	// "init_from_object" đã SAFE(item)
+		return true;
+	}
+
+	template <typename T>
+	Object* TypedArray<T>::pop()
+	{
+		if (len == 0u)
+		{
+			char block_location[32];
+			std::sprintf(block_location, "%s::pop", Traits::name);
+
+			__pycpp_error_retrieve_from_empty_container(block_location, Traits::name);
+			return nullptr;
+		}
+
+		return Box::from(pop_value(-1));
+	}
+
+	template <typename T>
+	void TypedArray<T>::extend(Iterable* iterable)
+	{
+		// Nhân đôi chính nó
+		if (iterable == this)
+		{
+			multiply_with_int(2u);
+			return;
+		}
+
+		switch (iterable->type_index())
+		{
+		case TypeIndex::I32Array:
+			extend_from_typed(static_cast<TypedArray<i32>*>(iterable));
+			return;
+
+		case TypeIndex::I64Array:
+			extend_from_typed(static_cast<TypedArray<i64>*>(iterable));
+			return;
+
+		case TypeIndex::F32Array:
+			extend_from_typed(static_cast<TypedArray<f32>*>(iterable));
+			return;
+
+		case TypeIndex::F64Array:
+			extend_from_typed(static_cast<TypedArray<f64>*>(iterable));
+			return;
+
+		default:
+			break;
+		}
+
+		auto __array = as_array(iterable);
+		if (__array)
+		{
+			extend_from_array(__array);
+			return;
+		}
+
+		extend_from_iterable(iterable);
+	}
+
+	#pragma endregion
+
+	#pragma region Override List
+
+	template <typename T>
+	u32 TypedArray<T>::capacity()
+	{
+		return capacity_of_data;
+	}
+
+	template <typename T>
+	void TypedArray<T>::set(i32 index, Object* item)
+	{
+		auto position = normalize_index(index, len, "set");
+		data[position] = Box::init_from_object(item);
+	}
+
+	template <typename T>
+	void TypedArray<T>::insert(i32 index, Object* item)
+	{
+		// Kiểm tra "index" trước khi SAFE(item)
+		normalize_index(index, len + 1u, "insert");
+		insert_value(index, Box::init_from_object(item));
+	}
+
+	template <typename T>
+	Object* TypedArray<T>::pop(i32 index)
+	{
+		return Box::from(pop_value(index));
+	}
+
+	template <typename T>
+	void TypedArray<T>::remove(i32 index)
+	{
+		pop_value(index);
+	}
+
+	template <typename T>
+	void TypedArray<T>::sort()
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			// NaN không so sánh được với giá trị nào : đưa về cuối để giữ thứ tự yếu chặt
+			std::sort(data, data + len, [](T a, T b) { return a < b || (a == a && b != b); });
+		}
+		else
+			std::sort(data, data + len);
+	}
+
+	#pragma endregion
+
+	#pragma region Raw Access
+
+	template <typename T>
+	T TypedArray<T>::get_value(i32 index)
+	{
+		return data[normalize_index(index, len, "get")];
+	}
+
+	template <typename T>
+	void TypedArray<T>::set_value(i32 index, T value)
+	{
+		data[normalize_index(index, len, "set")] = value;
+	}
+
+	template <typename T>
+	void TypedArray<T>::insert_value(i32 index, T value)
+	{
+		auto position = normalize_index(index, len + 1u, "insert");
+
+		if (len == capacity_of_data)
+			allocation_grow(len + 1u);
+
+		std::memmove(data + position + 1u, data + position, sizeof(T) * (len - position));
+		data[position] = value;
+		++len;
+	}
+
+	template <typename T>
+	T TypedArray<T>::pop_value(i32 index)
+	{
+		auto position = normalize_index(index, len, "pop");
+		T result = data[position];
+
+		std::memmove(data + position, data + position + 1u, sizeof(T) * (len - position - 1u));
+		--len;
+
+		allocation_shrink();
+		return result;
+	}
+
+	template <typename T>
+	void TypedArray<T>::extend_values(const T* values, u32 count)
+	{
+		if (count == 0u)
+			return;
+
+		if (len + count > capacity_of_data)
+			allocation_grow(len + count);
+
+		std::memcpy(data + len, values, sizeof(T) * count);
+		len += count;
+	}
+
+	template <typename T>
+	void TypedArray<T>::reserve(u32 n_capacity)
+	{
+		if (n_capacity > capacity_of_data)
+			allocation_resize(n_capacity);
+	}
+
+	template <typename T>
+	void TypedArray<T>::resize(u32 n_len)
+	{
+		if (n_len > capacity_of_data)
+			allocation_resize(n_len);
+
+		if (n_len > len)
+			std::memset(data + len, 0, sizeof(T) * (n_len - len));
+		len = n_len;
+
+		allocation_shrink();
+	}
+
+	template <typename T>
+	void TypedArray<T>::shrink_to_fit()
+	{
+		if (len != capacity_of_data)
+			allocation_resize(len);
+	}
+
+	#pragma endregion
+
+	#pragma region Private Methods
+
+	template <typename T>
+	bool TypedArray<T>::equal_with_typed(TypedArray* other)
+	{
+		if (len != other->len)
+		{
+			SAFE(other);
+			return false;
+		}
+
+		bool result = true;
+		for (u32 i = 0u; i < len; ++i)
+			if (data[i] != other->data[i])
+			{
+				result = false;
+				break;
+			}
+
+		SAFE(other);
+		return result;
+	}
+
+	template <typename T>
+	i32 TypedArray<T>::rich_compare_with_typed(TypedArray* other)
+	{
+		auto min_len = pycpp::min(len, other->len);
+		i32 result = 0;
+
+		for (u32 i = 0u; i < min_len; ++i)
+		{
+			// Giống "numeric_compare" : NaN bằng mọi giá trị
+			if (data[i] < other->data[i])
+				result = -1;
+			else if (other->data[i] < data[i])
+				result = 1;
+
+			if (result != 0)
+				break;
+		}
+
+		if (result == 0)
+			result = i32(len) - i32(other->len);
+
+		SAFE(other);
+		return result;
+	}
+
+	template <typename T>
+	template <typename U>
+	void TypedArray<T>::extend_from_typed(TypedArray<U>* source)
+	{
+		if constexpr (std::is_same_v<T, U>)
+			extend_values(source->data, source->len);
+		else
+		{
+			reserve(len + source->len);
+			for (u32 i = 0u; i < source->len; ++i)
+				data[len++] = T(source->data[i]);
+		}
+
+		SAFE(source);
+	}
+
+	template <typename T>
+	void TypedArray<T>::extend_from_array(__Array* source)
+	{
+		reserve(len + source->len);
+		for (u32 i = 0u; i < source->len; ++i)
+			data[len++] = Box::init_from_object(source->data[i]);
+
+		SAFE(source);
+	}
+
+	template <typename T>
+	void TypedArray<T>::extend_from_iterable(Iterable* iterable)
+	{
+		auto iter = iterable->first();
+
+		for (; iter->is_valid(); iter->next())
+			push_value(Box::init_from_object(iter->get()));
+
+		SAFE(iter);
+		SAFE(iterable);
+	}
+
+	template <typename T>
+	void TypedArray<T>::multiply_with_int(u32 multiplier)
+	{
+		if (len == 0u || multiplier == 1u)
+			return;
+
+		if (multiplier == 0u)
+		{
+			clear();
+			return;
+		}
+
+		reserve(len * multiplier);
+		for (u32 i = 1u; i < multiplier; ++i)
+			std::memcpy(data + i * len, data, sizeof(T) * len);
+
+		len *= multiplier;
+	}
+
+	template <typename T>
+	void TypedArray<T>::allocation_grow(u32 n_len)
+	{
+		// Dung lượng có dạng {2^k - 1}, tối thiểu 7
+		u32 n_capacity = (capacity_of_data << 1u) | 7u;
+		if (n_capacity < n_len)
+			n_capacity = n_len;
+
+		allocation_resize(n_capacity);
+	}
+
+	template <typename T>
+	void TypedArray<T>::allocation_shrink()
+	{
+		// Chỉ giảm khi số phần tử < 1/4 dung lượng, tránh cấp phát lại liên tục khi push / pop xen kẽ
+		if (capacity_of_data > 7u && len < (capacity_of_data >> 2u))
+			allocation_resize(capacity_of_data >> 1u);
+	}
+
+	template <typename T>
+	void TypedArray<T>::allocation_resize(u32 n_capacity)
+	{
+		T* n_data = n_capacity == 0u ? nullptr : new T[n_capacity];
+		if (len != 0u)
+			std::memcpy(n_data, data, sizeof(T) * len);
+
+		delete[] data;
+		data = n_data;
+		capacity_of_data = n_capacity;
+	}
+
+	template <typename T>
+	u32 TypedArray<T>::normalize_index(i32 index, u32 bound, const char* method)
+	{
+		if (index < -i32(len) || index >= i32(bound))
+		{
+			char block_location[64];
+			std::sprintf(block_location, "%s::%s", Traits::name, method);
+
+			__pycpp_error_out_of_bound(block_location);
+		}
+
+		if (index < 0)
+			index += i32(len);
+		return u32(index);
+	}
+
+	#pragma endregion
+
+	#pragma region Iterator
+
+	template <typename T>
+	TypedArray<T>::iterator::iterator(TypedArray* source, i32 index) :
+		source(source), index(index), cur(nullptr)
+	{
+		INREF(source);
+	}
+
+	template <typename T>
+	TypedArray<T>::iterator::~iterator()
+	{
+		if (cur)
+		{
+			DECREF(cur);
+		}
+		DECREF(source);
+	}
+
+	template <typename T>
+	i64 TypedArray<T>::iterator::type()
+	{
+		return type_id;
+	}
+
+	template <typename T>
+	Object* TypedArray<T>::iterator::as_object()
+	{
+		return this;
+	}
+
+	template <typename T>
+	std::string TypedArray<T>::iterator::class_name()
+	{
+		return std::string(Traits::name) + "::iterator";
+	}
+
+	template <typename T>
+	u32 TypedArray<T>::iterator::bytes()
+	{
+		return sizeof(iterator);
+	}
+
+	template <typename T>
+	bool TypedArray<T>::iterator::is_valid()
+	{
+		return index >= 0 && index < i32(source->len);
+	}
+
+	template <typename T>
+	void TypedArray<T>::iterator::next()
+	{
+		if (cur)
+		{
+			DECREF(cur);
+			cur = nullptr;
+		}
+		++index;
+	}
+
+	template <typename T>
+	void TypedArray<T>::iterator::prev()
+	{
+		if (cur)
+		{
+			DECREF(cur);
+			cur = nullptr;
+		}
+		--index;
+	}
+
+	template <typename T>
+	Object* TypedArray<T>::iterator::get()
+	{
+		if (is_valid() == false)
+		{
+			char content_error[128];
+			std::sprintf(content_error,
+				"Error in %s::iterator::get() : "
+				"you need to call is_valid() before calling get() !",
+				Traits::name);
+
+			std::cout << content_error << std::endl;
+			throw std::exception("Error : invalid Iterator");
+			return nullptr;
+		}
+
+		// Chỉ đóng hộp khi được gọi, giữ tham chiếu đến khi Iterator di chuyển
+		if (cur == nullptr)
+		{
+			cur = Box::from(source->data[index]);
+			INREF(cur);
+		}
+
+		return cur;
+	}
+
+	#pragma endregion
+
+	template class TypedArray<i32>;
+	template class TypedArray<i64>;
+	template class TypedArray<f32>;
+	template class TypedArray<f64>;
+
+#pragma endregion
+
+}
\ No newline at end of file
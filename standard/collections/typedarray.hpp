@@ -0,0 +1,311 @@
+#pragma once
+
+#include "../base/object.hpp"
+#include "../base/primitive.hpp"
+#include "iterable.hpp"
+
+#include <cstring>
+
+namespace pycpp
+{
+	class View;
+
+#pragma region Declaration : Typed Array Traits
+
+	/*
+	Typed Array : List lưu trực tiếp giá trị số ( i32, i64, f32, f64 ) trong một mảng liên tiếp.
+
+	- Không có Object nào được lưu : mỗi phần tử chỉ tốn sizeof(T) byte thay vì một con trỏ và một I32 / F64,
+	  các vòng lặp trên "raw()" không phải đọc qua con trỏ ( có thể vector hóa ).
+	- "get" / "pop" / Iterator đóng hộp ( boxing ) giá trị khi được gọi, trả về Object tạm ( cần SAFE hoặc gán vào var ).
+	- "push" / "set" / "insert" nhận Boolean, I32, I64, F32, F64 và ép về T ( như I32(Object*) ... ).
+	- "hash" bằng với hash của ArrayList chứa các giá trị đã đóng hộp tương ứng.
+	- Không chứa Object nên không được theo dõi bởi bộ thu gom chu trình.
+	*/
+
+	template <typename T>
+	struct __TypedArrayTraits;
+
+	template <>
+	struct __TypedArrayTraits<i32>
+	{
+		using Box = I32;
+		static constexpr const TypeIndex type_index = TypeIndex::I32Array;
+		static constexpr const char* name = "I32Array";
+
+		// Bằng với I32::hash.
+		static inline u64 hash(i32 value) { return u64(value); }
+	};
+
+	template <>
+	struct __TypedArrayTraits<i64>
+	{
+		using Box = I64;
+		static constexpr const TypeIndex type_index = TypeIndex::I64Array;
+		static constexpr const char* name = "I64Array";
+
+		// Bằng với I64::hash.
+		static inline u64 hash(i64 value) { return u64(value); }
+	};
+
+	template <>
+	struct __TypedArrayTraits<f32>
+	{
+		using Box = F32;
+		static constexpr const TypeIndex type_index = TypeIndex::F32Array;
+		static constexpr const char* name = "F32Array";
+
+		// Bằng với F32::hash.
+		static inline u64 hash(f32 value)
+		{
+			i32 bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return u64(i64(bits));
+		}
+	};
+
+	template <>
+	struct __TypedArrayTraits<f64>
+	{
+		using Box = F64;
+		static constexpr const TypeIndex type_index = TypeIndex::F64Array;
+		static constexpr const char* name = "F64Array";
+
+		// Bằng với F64::hash.
+		static inline u64 hash(f64 value)
+		{
+			u64 bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return bits;
+		}
+	};
+
+#pragma endregion
+
+#pragma region Declaration : Typed Array
+
+	template <typename T>
+	class TypedArray final : public List
+	{
+		using Traits = __TypedArrayTraits<T>;
+		using Box = typename Traits::Box;
+
+		template <typename U>
+		friend class TypedArray;
+		friend View;
+
+		T* data;
+		u32 capacity_of_data;
+		u32 len;
+
+	public:
+		static constexpr const i64 type_id = i64(Traits::type_index);
+
+		class iterator;
+		friend iterator;
+
+	#pragma region Typed Array
+
+		#pragma region Constructors & Destructor
+
+		TypedArray();
+		TypedArray(std::initializer_list<T> list);
+		TypedArray(const T* values, u32 count);
+		TypedArray(TypedArray& source);
+		TypedArray(Iterable* iterable);
+
+		~TypedArray();
+
+		#pragma endregion
+
+		#pragma region Override Object
+
+		i64 type() override;
+		Object* as_object() override;
+		std::string class_name() override;
+		void output() override;
+		void output(std::string& out) override;
+		u64 hash() override;
+		u32 bytes() override;
+		Object* copy() override;
+
+		bool equal(Object* other) override;
+		i32 rich_compare(Object* other) override;
+
+		// TypedArray + Iterable.
+		// => "this" thêm toàn bộ phần tử từ Iterable và trả về "this".
+		Object* add(Object* other) override;
+
+		// TypedArray * Integer ( với Integer >= 0 ).
+		// => Số phần tử trong "this" gấp Integer lần và trả về "this".
+		Object* mul(Object* other) override;
+
+		#pragma endregion
+
+		#pragma region Override Iterable
+
+		Iterator* first() override;
+		Iterator* last() override;
+
+		#pragma endregion
+
+		#pragma region Override Arguments
+
+		bool is_empty() override;
+		u32 size() override;
+
+		// Trả về Object tạm mang giá trị tại vị trí "index".
+		Object* get(i32 index) override;
+
+		bool equal(Arguments* arguments) override;
+		i32 rich_compare(Arguments* arguments) override;
+
+		#pragma endregion
+
+		#pragma region Override Container
+
+		void clear() override;
+
+		// Trả về "true" nếu có phần tử bằng "item" ( so sánh theo giá trị số ).
+		bool contains(Object* item) override;
+
+		// Thêm giá trị của "item" vào cuối, luôn trả về "true".
+		bool push(Object* item) override;
+
+		// Xóa và trả về ( Object tạm ) phần tử ở cuối.
+		Object* pop() override;
+
+		void extend(Iterable* iterable) override;
+
+		#pragma endregion
+
+		#pragma region Override List
+
+		u32 capacity() override;
+		void set(i32 index, Object* item) override;
+		void insert(i32 index, Object* item) override;
+		Object* pop(i32 index) override;
+		void remove(i32 index) override;
+
+		// Sắp xếp tăng dần, NaN đứng cuối.
+		void sort() override;
+
+		#pragma endregion
+
+		#pragma region Raw Access
+
+		// Truy cập trực tiếp vùng nhớ, không đóng hộp.
+		// (!) : con trỏ mất hiệu lực sau khi thêm / xóa phần tử.
+
+		inline T* raw() { return data; }
+		inline T* begin() { return data; }
+		inline T* end() { return data + len; }
+
+		T get_value(i32 index);
+		void set_value(i32 index, T value);
+		void insert_value(i32 index, T value);
+		T pop_value(i32 index = -1);
+
+		inline void push_value(T value)
+		{
+			if (len == capacity_of_data)
+				allocation_grow(len + 1u);
+			data[len++] = value;
+		}
+
+		// Thêm "count" giá trị liên tiếp vào cuối.
+		void extend_values(const T* values, u32 count);
+
+		// Đảm bảo dung lượng tối thiểu "n_capacity".
+		void reserve(u32 n_capacity);
+
+		// Đổi số phần tử thành "n_len", các phần tử thêm mới bằng 0.
+		void resize(u32 n_len);
+
+		// Giải phóng phần dung lượng chưa dùng.
+		void shrink_to_fit();
+
+		#pragma endregion
+
+		#pragma region Private Methods
+	private:
+
+		// Chỉ so sánh hai TypedArray cùng kiểu.
+		bool equal_with_typed(TypedArray* other);
+		i32 rich_compare_with_typed(TypedArray* other);
+
+		// Ép các giá trị kiểu U sang T và thêm vào cuối.
+		template <typename U>
+		void extend_from_typed(TypedArray<U>* source);
+
+		void extend_from_array(__Array* source);
+		void extend_from_iterable(Iterable* iterable);
+
+		void multiply_with_int(u32 multiplier);
+
+		// Tăng dung lượng để chứa được "n_len" phần tử.
+		void allocation_grow(u32 n_len);
+
+		// Giảm dung lượng khi số phần tử nhỏ hơn 1/4 dung lượng.
+		void allocation_shrink();
+
+		void allocation_resize(u32 n_capacity);
+
+		// Chuẩn hóa "index" âm, ném lỗi nếu nằm ngoài [-len, bound).
+		u32 normalize_index(i32 index, u32 bound, const char* method);
+
+		#pragma endregion
+
+	#pragma endregion
+
+	#pragma region Iterator
+	public:
+		class iterator final : public Iterator, public Object
+		{
+			friend TypedArray;
+
+			TypedArray* source;
+			i32 index;
+
+			// Giá trị đã đóng hộp của phần tử hiện tại, tạo khi gọi "get".
+			Box* cur;
+
+			iterator(TypedArray* source, i32 index);
+		public:
+			~iterator();
+
+			BUILTIN_TYPE_ID(TypedArrayIterator);
+
+			//==========     Override Object     ==========//
+
+			i64 type() override;
+			Object* as_object() override;
+			std::string class_name() override;
+			u32 bytes() override;
+
+			//==========     Override Iterator     ==========//
+
+			bool is_valid() override;
+			void next() override;
+			void prev() override;
+			Object* get() override;
+		};
+
+	#pragma endregion
+
+	};
+
+	// Các kiểu được triển khai trong typedarray.cpp.
+	extern template class TypedArray<i32>;
+	extern template class TypedArray<i64>;
+	extern template class TypedArray<f32>;
+	extern template class TypedArray<f64>;
+
+	using I32Array = TypedArray<i32>;
+	using I64Array = TypedArray<i64>;
+	using F32Array = TypedArray<f32>;
+	using F64Array = TypedArray<f64>;
+
+#pragma endregion
+
+}
\ No newline at end of file
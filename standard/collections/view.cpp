@@ -0,0 +1,633 @@
+#include "view.hpp"
+#include "arraylist.hpp"
+#include "../base/algo.hpp"
+#include "../base/error.hpp"
+
+#include <type_traits>
+
+// #define _CRT_SECURE_NO_WARNINGS
+#pragma warning(disable : 4996)
+
+namespace pycpp
+{
+
+#pragma region Private Helpers
+
+	// Gọi "function(values)" với mảng giá trị của TypedArray tương ứng "kind".
+	template <typename Function>
+	static inline auto typed_dispatch(TypeIndex kind, List* typed, Function&& function)
+	{
+		switch (kind)
+		{
+		case TypeIndex::I32:
+			return function(static_cast<I32Array*>(typed)->raw());
+		case TypeIndex::I64:
+			return function(static_cast<I64Array*>(typed)->raw());
+		case TypeIndex::F32:
+			return function(static_cast<F32Array*>(typed)->raw());
+		default:
+			return function(static_cast<F64Array*>(typed)->raw());
+		}
+	}
+
+	template <typename Pointer>
+	using __value_t = std::remove_pointer_t<Pointer>;
+
+	// Chuẩn hóa [start : end : step] trên "n" phần tử ( giống slice.indices của Python ).
+	static u32 normalize_slice(i64 n, i32& start, i32 end, i32 step)
+	{
+		if (step == 0)
+		{
+			char content_error[128];
+			sprintf_s(content_error, "Error in View::View : step cannot be zero !");
+
+			std::cout << content_error << std::endl;
+			throw std::exception("Error : slice step cannot be zero");
+		}
+
+		i64 first = start, stop = end;
+
+		if (first < 0)
+		{
+			first += n;
+			if (first < 0)
+				first = step < 0 ? -1 : 0;
+		}
+		else if (first >= n)
+			first = step < 0 ? n - 1 : n;
+
+		if (stop < 0)
+		{
+			stop += n;
+			if (stop < 0)
+				stop = step < 0 ? -1 : 0;
+		}
+		else if (stop >= n)
+			stop = step < 0 ? n - 1 : n;
+
+		start = i32(first);
+
+		if (step < 0)
+			return stop < first ? u32((first - stop - 1) / (-i64(step)) + 1) : 0u;
+		return first < stop ? u32((stop - first - 1) / i64(step) + 1) : 0u;
+	}
+
+#pragma endregion
+
+#pragma region Definition : View
+
+	#pragma region Constructors & Destructor
+
+	View::View() :
+		base(nullptr), kind(TypeIndex::Unknown), objects(nullptr), fixed_data(nullptr),
+		typed(nullptr), base_len(nullptr), start(0), step(1), len(0u) {}
+
+	View::View(Object* base) : View()
+	{
+		if (base->type_index() == TypeIndex::View)
+		{
+			attach_view(static_cast<View*>(base), 0, i32(static_cast<View*>(base)->len), 1);
+			SAFE(base);
+			return;
+		}
+
+		attach(base);
+		attach(base, 0, i32(*base_len), 1);
+	}
+
+	View::View(Object* base, i32 start, i32 end, i32 step) : View()
+	{
+		if (base->type_index() == TypeIndex::View)
+		{
+			// View trên View : cửa sổ mới trên cùng "base"
+			attach_view(static_cast<View*>(base), start, end, step);
+			SAFE(base);
+			return;
+		}
+
+		attach(base);
+		attach(base, start, end, step);
+	}
+
+	View::View(const View& source) :
+		base(source.base), kind(source.kind), objects(source.objects), fixed_data(source.fixed_data),
+		typed(source.typed), base_len(source.base_len), start(source.start), step(source.step), len(source.len)
+	{
+		if (objects == &source.fixed_data)
+			objects = &fixed_data;
+
+		if (base)
+		{
+			INREF(base);
+			if (base->is_tracked())
+				gc_track(this, gc_node);
+		}
+	}
+
+	View::~View()
+	{
+		if (base)
+			DECREF(base);
+	}
+
+	#pragma endregion
+
+	#pragma region Override Object
+
+	i64 View::type()
+	{
+		return type_id;
+	}
+
+	Object* View::as_object()
+	{
+		return this;
+	}
+
+	std::string View::class_name()
+	{
+		return "View";
+	}
+
+	void View::output()
+	{
+		std::string content;
+		output(content);
+		std::cout << content;
+	}
+
+	void View::output(std::string& out)
+	{
+		check_bounds("output");
+
+		std::string content, str_cur;
+		for (u32 i = 0u; i < len; ++i)
+		{
+			auto cur = element(i);
+			if (cur == base)
+				str_cur = "base";
+			else
+				cur->output(str_cur);
+			SAFE(cur);
+
+			if (i > 0u)
+				content += ", ";
+			content += str_cur;
+		}
+
+		out = "View([" + content + "])";
+	}
+
+	u64 View::hash()
+	{
+		// Giống "hash_array" trên các phần tử của cửa sổ
+		check_bounds("hash");
+		if (len == 0u)
+			return HASH_ARRAY_BASE;
+
+		u64 hash_value = 0u;
+		i64 cur = start;
+
+		if (kind == TypeIndex::Unknown)
+		{
+			Object** data = *objects;
+			for (u32 i = 0u; i < len; ++i, cur += step)
+				hash_value = hash_array_combine(hash_value, hash_finalize(data[cur]->hash(), PYCPP_HASH_POLICY));
+			return hash_value;
+		}
+
+		return typed_dispatch(kind, typed, [&](auto values)
+			{
+				using T = __value_t<decltype(values)>;
+				for (u32 i = 0u; i < len; ++i, cur += step)
+					hash_value = hash_array_combine(hash_value,
+						hash_finalize(__TypedArrayTraits<T>::hash(values[cur]), PYCPP_HASH_POLICY));
+				return hash_value;
+			});
+	}
+
+	u32 View::bytes()
+	{
+		// Không sở hữu phần tử nào
+		return sizeof(View);
+	}
+
+	void View::traverse(TraverseVisitor visit, void* context)
+	{
+		if (base)
+			visit(base, context);
+	}
+
+	void View::clear_references()
+	{
+		// Chỉ được gọi bởi bộ thu gom với View là rác
+		auto __base = base;
+
+		base = nullptr;
+		len = 0u;
+		DECREF(__base);
+	}
+
+	Object* View::copy()
+	{
+		return new View(*this);
+	}
+
+	bool View::equal(Object* other)
+	{
+		auto arguments = as_arguments(other);
+		if (arguments == nullptr)
+		{
+			// Không thể so sánh => Không bằng nhau
+			SAFE(other);
+			return false;
+		}
+
+		return equal(arguments);
+	}
+
+	#pragma endregion
+
+	#pragma region Override Iterable
+
+	bool View::is_empty()
+	{
+		return len == 0u;
+	}
+
+	u32 View::size()
+	{
+		return len;
+	}
+
+	Iterator* View::first()
+	{
+		return new iterator(this, 0);
+	}
+
+	Iterator* View::last()
+	{
+		return new iterator(this, i32(len) - 1);
+	}
+
+	#pragma endregion
+
+	#pragma region Override Arguments
+
+	Object* View::get(i32 index)
+	{
+		if (index < -i32(len) || index >= i32(len))
+			__pycpp_error_out_of_bound("View::get(i32)");
+
+		if (index < 0)
+			index += i32(len);
+
+		if (position(u32(index)) >= *base_len)
+			__pycpp_error_out_of_bound("View::get(i32)");
+
+		return element(u32(index));
+	}
+
+	bool View::contains(Object* item)
+	{
+		check_bounds("contains");
+
+		bool result = false;
+		for (u32 i = 0u; i < len; ++i)
+		{
+			// Giữ phần tử tạm trong khi so sánh ( "equal" có thể SAFE tham số )
+			auto cur = element(i);
+			INREF(cur);
+			bool same = item->equal(cur);
+			DECREF(cur);
+
+			if (same)
+			{
+				result = true;
+				break;
+			}
+		}
+
+		SAFE(item);
+		return result;
+	}
+
+	bool View::equal(Arguments* arguments)
+	{
+		auto object = arguments->as_object();
+		if (object == this)
+			return true;
+
+		check_bounds("equal");
+		if (len != arguments->size())
+		{
+			SAFE(arguments);
+			return false;
+		}
+
+		// Hai View cùng kiểu TypedArray : so sánh trực tiếp giá trị
+		if (object->type_index() == TypeIndex::View && kind != TypeIndex::Unknown &&
+			static_cast<View*>(object)->kind == kind)
+		{
+			auto other = static_cast<View*>(object);
+			other->check_bounds("equal");
+
+			bool result = typed_dispatch(kind, typed, [&](auto values)
+				{
+					using T = __value_t<decltype(values)>;
+					const T* other_values = static_cast<TypedArray<T>*>(other->typed)->raw();
+
+					for (u32 i = 0u; i < len; ++i)
+						if (values[position(i)] != other_values[other->position(i)])
+							return false;
+					return true;
+				});
+
+			SAFE(arguments);
+			return result;
+		}
+
+		bool result = true;
+		for (u32 i = 0u; i < len && result; ++i)
+		{
+			auto a = element(i);
+			auto b = arguments->get(i);
+
+			INREF(b);
+			result = a->equal(b);
+			DECREF(b);
+			SAFE(a);
+		}
+
+		SAFE(arguments);
+		return result;
+	}
+
+	#pragma endregion
+
+	#pragma region Standard Methods
+
+	Object* View::base_object()
+	{
+		return base;
+	}
+
+	View* View::slice(i32 start, i32 end, i32 step)
+	{
+		auto result = new View();
+		result->attach_view(this, start, end, step);
+		return result;
+	}
+
+	List* View::sorted()
+	{
+		check_bounds("sorted");
+
+		if (kind == TypeIndex::Unknown)
+		{
+			auto result = new ArrayList();
+			Object** data = *objects;
+			for (u32 i = 0u; i < len; ++i)
+				result->push(data[position(i)]);
+
+			result->sort();
+			return result;
+		}
+
+		return typed_dispatch(kind, typed, [&](auto values) -> List*
+			{
+				using T = __value_t<decltype(values)>;
+
+				auto result = new TypedArray<T>();
+				result->resize(len);
+
+				T* out = result->raw();
+				for (u32 i = 0u; i < len; ++i)
+					out[i] = values[position(i)];
+
+				result->sort();
+				return result;
+			});
+	}
+
+	#pragma endregion
+
+	#pragma region Private Methods
+
+	void View::attach(Object* base)
+	{
+		switch (base->type_index())
+		{
+		case TypeIndex::ArrayList:
+		case TypeIndex::Tuple:
+		{
+			auto __array = as_array(base);
+			objects = &__array->data;
+			base_len = &__array->len;
+			return;
+		}
+
+		case TypeIndex::I32Array:
+			kind = TypeIndex::I32;
+			typed = static_cast<I32Array*>(base);
+			base_len = &static_cast<I32Array*>(base)->len;
+			return;
+
+		case TypeIndex::I64Array:
+			kind = TypeIndex::I64;
+			typed = static_cast<I64Array*>(base);
+			base_len = &static_cast<I64Array*>(base)->len;
+			return;
+
+		case TypeIndex::F32Array:
+			kind = TypeIndex::F32;
+			typed = static_cast<F32Array*>(base);
+			base_len = &static_cast<F32Array*>(base)->len;
+			return;
+
+		case TypeIndex::F64Array:
+			kind = TypeIndex::F64;
+			typed = static_cast<F64Array*>(base);
+			base_len = &static_cast<F64Array*>(base)->len;
+			return;
+
+		default:
+		{
+			char content_error[128];
+			sprintf_s(content_error,
+				"Error in View::View : cannot create a View on %s "
+				"( ArrayList, Tuple, TypedArray, FixedArray or View ) !",
+				base->class_name().c_str());
+
+			std::cout << content_error << std::endl;
+			SAFE(base);
+			throw std::exception("Error : invalid data type");
+		}
+		}
+	}
+
+	void View::attach(Object* base, i32 start, i32 end, i32 step)
+	{
+		len = normalize_slice(i64(*base_len), start, end, step);
+		this->start = start;
+		this->step = step;
+
+		this->base = base;
+		INREF(base);
+
+		if (base->is_tracked())
+			gc_track(this, gc_node);
+	}
+
+	void View::attach_view(View* source, i32 start, i32 end, i32 step)
+	{
+		len = normalize_slice(i64(source->len), start, end, step);
+
+		kind = source->kind;
+		objects = source->objects == &source->fixed_data ? &fixed_data : source->objects;
+		fixed_data = source->fixed_data;
+		typed = source->typed;
+		base_len = source->base_len;
+
+		this->start = i32(source->position(0u) + i64(start) * source->step);
+		this->step = source->step * step;
+
+		base = source->base;
+		if (base)
+		{
+			INREF(base);
+			if (base->is_tracked())
+				gc_track(this, gc_node);
+		}
+		else
+			len = 0u;
+	}
+
+	void View::check_bounds(const char* method)
+	{
+		if (len == 0u)
+			return;
+
+		// Vị trí lớn nhất của cửa sổ
+		u32 bound = step > 0 ? position(len - 1u) : u32(start);
+		if (bound >= *base_len)
+		{
+			char block_location[64];
+			std::sprintf(block_location, "View::%s", method);
+
+			__pycpp_error_out_of_bound(block_location);
+		}
+	}
+
+	Object* View::element(u32 index)
+	{
+		u32 cur = position(index);
+
+		switch (kind)
+		{
+		case TypeIndex::Unknown:
+			return (*objects)[cur];
+		case TypeIndex::I32:
+			return I32::from(static_cast<I32Array*>(typed)->raw()[cur]);
+		case TypeIndex::I64:
+			return I64::from(static_cast<I64Array*>(typed)->raw()[cur]);
+		case TypeIndex::F32:
+			return F32::from(static_cast<F32Array*>(typed)->raw()[cur]);
+		default:
+			return F64::from(static_cast<F64Array*>(typed)->raw()[cur]);
+		}
+	}
+
+	#pragma endregion
+
+	#pragma region Iterator
+
+	View::iterator::iterator(View* source, i32 index) :
+		source(source), index(index), cur(nullptr)
+	{
+		INREF(source);
+	}
+
+	View::iterator::~iterator()
+	{
+		if (cur)
+		{
+			DECREF(cur);
+		}
+		DECREF(source);
+	}
+
+	i64 View::iterator::type()
+	{
+		return type_id;
+	}
+
+	Object* View::iterator::as_object()
+	{
+		return this;
+	}
+
+	std::string View::iterator::class_name()
+	{
+		return "View::iterator";
+	}
+
+	u32 View::iterator::bytes()
+	{
+		return sizeof(iterator);
+	}
+
+	bool View::iterator::is_valid()
+	{
+		return index >= 0 && index < i32(source->len);
+	}
+
+	void View::iterator::next()
+	{
+		if (cur)
+		{
+			DECREF(cur);
+			cur = nullptr;
+		}
+		++index;
+	}
+
+	void View::iterator::prev()
+	{
+		if (cur)
+		{
+			DECREF(cur);
+			cur = nullptr;
+		}
+		--index;
+	}
+
+	Object* View::iterator::get()
+	{
+		if (is_valid() == false)
+		{
+			char content_error[128];
+			std::sprintf(content_error,
+				"Error in View::iterator::get() : "
+				"you need to call is_valid() before calling get() !");
+
+			std::cout << content_error << std::endl;
+			throw std::exception("Error : invalid Iterator");
+			return nullptr;
+		}
+
+		// Giữ tham chiếu đến khi Iterator di chuyển ( phần tử tạm với TypedArray )
+		if (cur == nullptr)
+		{
+			cur = source->get(index);
+			INREF(cur);
+		}
+
+		return cur;
+	}
+
+	#pragma endregion
+
+#pragma endregion
+
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "../base/object.hpp"
+#include "../base/collector.hpp"
+#include "iterable.hpp"
+#include "array.hpp"
+#include "typedarray.hpp"
+
+namespace pycpp
+{
+	template <u32 Capacity>
+	class FixedArray;
+
+	template <u32 Capacity>
+	class __FixedArray;
+
+#pragma region Declaration : View
+
+	/*
+	View : cửa sổ chỉ đọc ( start, end, step ) trên vùng nhớ của ArrayList, Tuple, TypedArray hoặc FixedArray,
+	không sao chép phần tử và không tăng tham chiếu của từng phần tử ( tương tự memoryview ).
+
+	- Giữ đúng một tham chiếu đến "base", đọc thẳng vùng nhớ hiện tại của "base" ở mỗi lần truy cập
+	  ( "base" cấp phát lại vùng nhớ khi thêm phần tử không làm View mất hiệu lực ).
+	- "start", "end", "step" theo quy tắc cắt của Python : chỉ số âm được tính từ cuối, giá trị vượt ngoài
+	  được đưa về biên, "step" khác 0.
+	- Ném lỗi runtime khi truy cập nếu "base" đã bị xóa bớt phần tử và cửa sổ vượt quá "base".
+	- View trên TypedArray đóng hộp phần tử khi được gọi ( "get", Iterator ) : trả về Object tạm.
+	- "slice" của View tạo View mới trên cùng "base" ( không lồng nhau ).
+	- "hash" / "equal" giống Tuple chứa các phần tử tương ứng.
+	*/
+
+	class View final : public Iterable, public Arguments
+	{
+	public:
+		class iterator;
+		friend iterator;
+
+	#pragma region View
+
+	private:
+		// Giữ một tham chiếu, nullptr sau "clear_references".
+		Object* base;
+
+		// Unknown : mảng Object ( "objects" ), I32 / I64 / F32 / F64 : TypedArray ( "typed" ).
+		TypeIndex kind;
+
+		// Trỏ tới con trỏ vùng nhớ của "base" ( "data" của __Array hoặc "fixed_data" ).
+		Object** const* objects;
+		Object** fixed_data;
+
+		List* typed;
+
+		// Số phần tử hiện tại của "base".
+		const u32* base_len;
+
+		i32 start, step;
+		u32 len;
+
+		// Chỉ được theo dõi khi "base" được theo dõi ( có thể tạo chu trình ).
+		__GCNode gc_node;
+
+	public:
+		BUILTIN_TYPE_ID(View);
+
+		#pragma region Constructors & Destructor
+
+		// Toàn bộ "base".
+		View(Object* base);
+
+		// Các phần tử base[start], base[start + step] ... trước "end".
+		View(Object* base, i32 start, i32 end, i32 step = 1);
+
+		View(const View& source);
+
+		template <u32 Capacity>
+		View(FixedArray<Capacity>* base) : View(base, 0, i32(Capacity)) {}
+
+		template <u32 Capacity>
+		View(FixedArray<Capacity>* base, i32 start, i32 end, i32 step = 1) : View()
+		{
+			auto fixed = static_cast<__FixedArray<Capacity>*>(base);
+
+			fixed_data = fixed->data;
+			objects = &fixed_data;
+			base_len = &fixed->len;
+			attach(base, start, end, step);
+		}
+
+		~View();
+
+		#pragma endregion
+
+		#pragma region Override Object
+
+		i64 type() override;
+		Object* as_object() override;
+		std::string class_name() override;
+		void output() override;
+		void output(std::string& out) override;
+		u64 hash() override;
+		u32 bytes() override;
+		void traverse(TraverseVisitor visit, void* context) override;
+		void clear_references() override;
+
+		// View mới trên cùng "base" và cùng cửa sổ.
+		Object* copy() override;
+
+		bool equal(Object* other) override;
+
+		#pragma endregion
+
+		#pragma region Override Iterable
+
+		bool is_empty() override;
+		u32 size() override;
+
+		Iterator* first() override;
+		Iterator* last() override;
+
+		#pragma endregion
+
+		#pragma region Override Arguments
+
+		// Phần tử của "base" ( không tăng tham chiếu ) hoặc Object tạm với TypedArray.
+		Object* get(i32 index) override;
+
+		bool contains(Object* item) override;
+		bool equal(Arguments* arguments) override;
+
+		#pragma endregion
+
+		#pragma region Standard Methods
+
+		Object* base_object();
+
+		// View mới ( Object tạm ) trên các phần tử [start : end : step] của View này.
+		View* slice(i32 start, i32 end, i32 step = 1);
+
+		// List mới ( Object tạm ) chứa các phần tử đã sắp xếp tăng dần, "base" không thay đổi.
+		// TypedArray cùng kiểu với View trên TypedArray, còn lại là ArrayList.
+		List* sorted();
+
+		#pragma endregion
+
+		#pragma region Private Methods
+	private:
+
+		View();
+
+		// Gắn vùng nhớ của "base" ( ArrayList, Tuple, TypedArray ).
+		void attach(Object* base);
+
+		// Chuẩn hóa cửa sổ, INREF "base" và theo dõi nếu cần.
+		void attach(Object* base, i32 start, i32 end, i32 step);
+
+		// Cửa sổ [start : end : step] của "source" trên cùng "base".
+		void attach_view(View* source, i32 start, i32 end, i32 step);
+
+		// Vị trí trong "base" của phần tử thứ "index".
+		inline u32 position(u32 index) const
+		{
+			return u32(i64(start) + i64(index) * i64(step));
+		}
+
+		// Ném lỗi nếu cửa sổ vượt quá "base".
+		void check_bounds(const char* method);
+
+		// Phần tử thứ "index" ( đã kiểm tra ) : Object của "base" hoặc Object tạm.
+		Object* element(u32 index);
+
+		#pragma endregion
+
+	#pragma endregion
+
+	#pragma region Iterator
+	public:
+		class iterator final : public Iterator, public Object
+		{
+			friend View;
+
+			View* source;
+			i32 index;
+
+			// Phần tử hiện tại, giữ tham chiếu đến khi Iterator di chuyển.
+			Object* cur;
+
+			iterator(View* source, i32 index);
+		public:
+			~iterator();
+
+			BUILTIN_TYPE_ID(ViewIterator);
+
+			//==========     Override Object     ==========//
+
+			i64 type() override;
+			Object* as_object() override;
+			std::string class_name() override;
+			u32 bytes() override;
+
+			//==========     Override Iterator     ==========//
+
+			bool is_valid() override;
+			void next() override;
+			void prev() override;
+			Object* get() override;
+		};
+
+	#pragma endregion
+
+	};
+
+#pragma endregion
+
+}
\ No newline at end of file
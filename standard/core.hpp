@@ -3,12 +3,20 @@
 #pragma region Directory : base
 
 #include "base/algo.hpp"
+#include "base/allocator.hpp"
+#include "base/collector.hpp"
 #include "base/error.hpp"
 #include "base/object.hpp"
 #include "base/funtor.hpp"
+#include "base/intern.hpp"
+#include "base/numeric.hpp"
 #include "base/pair.hpp"
 #include "base/primitive.hpp"
+#include "base/refcount.hpp"
+#include "base/sort.hpp"
 #include "base/str.hpp"
+#include "base/trashcan.hpp"
+#include "base/typeinfo.hpp"
 #include "base/var.hpp"
 
 #pragma endregion
@@ -22,7 +30,11 @@
 #include "collections/hashtable.hpp"
 #include "collections/iterable.hpp"
 #include "collections/private_hashtable.hpp"
+#include "collections/reduce.hpp"
+#include "collections/elementwise.hpp"
 #include "collections/tuple.hpp"
+#include "collections/typedarray.hpp"
+#include "collections/view.hpp"
 
 #pragma endregion
 
@@ -10,8 +10,11 @@ namespace pycpp
 	template<u32 Capacity>
 	class FixedArray final : public List, public __FixedArray<Capacity>
 	{
+		// Được theo dõi bởi bộ thu gom chu trình.
+		__GCNode gc_node{ this };
+
 	public:
-		TYPE_ID(FixedArray<Capacity>);
+		BUILTIN_TYPE_ID(FixedArray);
 
 	#pragma region Constructors & Destructor
 
@@ -34,6 +37,11 @@ namespace pycpp
 			return type_id;
 		}
 
+		Object* as_object() override
+		{
+			return this;
+		}
+
 		std::string class_name() override
 		{
 			return typeid(FixedArray<Capacity>).name();
@@ -65,14 +73,24 @@ namespace pycpp
 			return pycpp::hash_array(__FixedArray<Capacity>::data, __FixedArray<Capacity>::len);
 		}
 
+		void traverse(TraverseVisitor visit, void* context) override
+		{
+			__FixedArray<Capacity>::traverse(visit, context);
+		}
+
+		void clear_references() override
+		{
+			__FixedArray<Capacity>::clear();
+		}
+
 
 		bool equal(Object* other) override
 		{
-			auto arguments = dynamic_cast<Arguments*>(other);
+			auto arguments = as_arguments(other);
 			if (arguments == nullptr)
 				return false;
 
-			auto __array = dynamic_cast<__Array*>(other);
+			auto __array = as_array(other);
 			if (__array)
 				return __FixedArray<Capacity>::equal(__array);
 			return Arguments::equal(arguments);
@@ -80,7 +98,7 @@ namespace pycpp
 
 		i32 rich_compare(Object* other) override
 		{
-			auto arguments = dynamic_cast<Arguments*>(other);
+			auto arguments = as_arguments(other);
 			if (arguments == nullptr)
 			{
 				char content_error[128];
@@ -96,7 +114,7 @@ namespace pycpp
 				return false;
 			}
 
-			auto __array = dynamic_cast<__Array*>(other);
+			auto __array = as_array(other);
 			if (__array)
 				return __FixedArray<Capacity>::rich_compare(__array);
 			return Arguments::rich_compare(arguments);
@@ -105,7 +123,7 @@ namespace pycpp
 
 		Object* add(Object* other) override
 		{
-			auto iterable = dynamic_cast<Iterable*>(other);
+			auto iterable = as_iterable(other);
 			if (iterable == nullptr)
 			{
 				char content_error[128];
@@ -133,11 +151,11 @@ namespace pycpp
 			switch (other_type)
 			{
 			case I32::type_id:
-				num = dynamic_cast<I32*>(other)->value;
+				num = static_cast<I32*>(other)->value;
 				break;
 
 			case I64::type_id:
-				num = (i32) dynamic_cast<I64*>(other)->value;
+				num = (i32) static_cast<I64*>(other)->value;
 				break;
 
 			default:
@@ -266,6 +284,24 @@ namespace pycpp
 
 #pragma endregion
 
+	#pragma region Steal Reference
+
+		// Các hàm "steal" nhận luôn tham chiếu của người gọi ( không INREF ) :
+		// array->push_steal(var.release()).
+
+		// Thêm phần tử vào cuối, trả về "false" nếu đã đầy.
+		bool push_steal(Object* item)
+		{
+			return __FixedArray<Capacity>::push_steal(item);
+		}
+
+		void insert_steal(i32 index, Object* item)
+		{
+			__FixedArray<Capacity>::insert_steal(index, item);
+		}
+
+	#pragma endregion
+
 	};
 
 #pragma endregion
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../base/object.hpp"
+#include "../base/collector.hpp"
+#include "../base/sort.hpp"
 #include "../collections/array.hpp"
 #include "../collections/private_hashtable.hpp"
 
@@ -13,12 +15,14 @@ namespace pycpp
 	struct Entry;
 	class __HashTable;
 	class Arguments;
+	class View;
 
 	template<u32 Capacity>
 	class __FixedArray
 	{
 		class iterator;
 		friend iterator;
+		friend View;
 
 	protected:
 		Object* data[Capacity];
@@ -58,21 +62,21 @@ namespace pycpp
 
 		__FixedArray(Iterable* iterable)
 		{
-			auto __array = dynamic_cast<__Array*>(iterable);
+			auto __array = as_array(iterable);
 			if (__array)
 			{
 				init_from_array(__array);
 				return;
 			}
 
-			auto __hashtable = dynamic_cast<__HashTable*>(iterable);
+			auto __hashtable = as_hashtable(iterable);
 			if (__hashtable)
 			{
 				init_from_hashtable(__hashtable);
 				return;
 			}
 
-			auto arguments = dynamic_cast<Arguments*>(iterable);
+			auto arguments = as_arguments(iterable);
 			if (arguments)
 			{
 				init_from_arguments(arguments);
@@ -86,8 +90,7 @@ namespace pycpp
 		{
 			for (u32 i = 0u; i < len; ++i)
 			{
-				DEREF(data[i]);
-				SAFE(data[i]);
+				DECREF(data[i]);
 			}
 		}
 
@@ -122,24 +125,21 @@ namespace pycpp
 		void init_from_hashtable(__HashTable* source)
 		{
 			len = pycpp::min(Capacity, source->len);
+			source->finish_rehash();
 
 			u32 increase_index = 0u;
 			for (u32 i = 0u; i < source->capacity; ++i)
 			{
-				auto head = source->data[i];
-				if (head == nullptr)
+				if (source->is_full(i) == false)
 					continue;
 
-				for (; head; head = head->next)
+				data[increase_index] = source->data[i].ref;
+				INREF(data[increase_index]);
+				++increase_index;
+				if (increase_index == Capacity)
 				{
-					data[increase_index] = head->ref;
-					INREF(data[increase_index]);
-					++increase_index;
-					if (increase_index == Capacity)
-					{
-						SAFE(source);
-						return;
-					}
+					SAFE(source);
+					return;
 				}
 			}
 
@@ -216,8 +216,7 @@ namespace pycpp
 		{
 			for (u32 i = 0u; i < len; ++i)
 			{
-				DEREF(data[i]);
-				SAFE(data[i]);
+				DECREF(data[i]);
 			}
 			len = 0u;
 		}
@@ -231,38 +230,53 @@ namespace pycpp
 				pycpp::swap(data[i], data[j]);
 		}
 
-		void sort()
+		void sort(SortPolicy policy = PYCPP_SORT_POLICY)
 		{
-			pycpp::shell_sort(data, len);
+			pycpp::sort_array(data, len, policy);
 		}
 
 		bool push(Object* item)
+		{
+			INREF(item);
+			return push_steal(item);
+		}
+
+		void insert(i32 index, Object* item)
+		{
+			INREF(item);
+			insert_steal(index, item);
+		}
+
+		// Tương tự "push" nhưng nhận luôn tham chiếu của người gọi ( không INREF ).
+		bool push_steal(Object* item)
 		{
 			if (len == Capacity)
 			{
-				SAFE(item);
+				DECREF(item);
 				return false;
 			}
 
-			INREF(item);
 			data[len++] = item;
 			return true;
 		}
 
-		void insert(i32 index, Object* item)
+		// Tương tự "insert" nhưng nhận luôn tham chiếu của người gọi ( không INREF ).
+		void insert_steal(i32 index, Object* item)
 		{
 			if (len == Capacity)
 			{
-				SAFE(item);
+				DECREF(item);
 				return;
 			}
 
 			// Error : out of bound
 			if (index < -i32(len) || index >= i32(len))
 			{
+				DECREF(item);
+
 				char block_location[32];
 				std::sprintf(block_location, "%s::insert",
-					dynamic_cast<Object*>(this)->class_name().c_str());
+					as_object()->class_name().c_str());
 
 				__pycpp_error_out_of_bound(block_location);
 			}
@@ -272,7 +286,6 @@ namespace pycpp
 
 			for (i32 i = (i32)len; i > index; --i)
 				data[i] = data[i - 1];
-			INREF(item);
 			data[index] = item;
 			++len;
 		}
@@ -282,7 +295,7 @@ namespace pycpp
 			// Error : retrieve from an empty Container
 			if (len == 0u)
 			{
-				std::string __class_name = dynamic_cast<Object*>(this);
+				std::string __class_name = as_object()->class_name();
 				char block_location[32];
 				std::sprintf(block_location, "%s::pop", __class_name.c_str());
 
@@ -299,7 +312,7 @@ namespace pycpp
 			// Error : retrieve from an empty Container
 			if (len == 0u)
 			{
-				std::string __class_name = dynamic_cast<Object*>(this);
+				std::string __class_name = as_object()->class_name();
 				char block_location[32];
 				std::sprintf(block_location, "%s::pop", __class_name.c_str());
 
@@ -311,7 +324,7 @@ namespace pycpp
 			{
 				char block_location[32];
 				std::sprintf(block_location, "%s::pop(i32 index)",
-					dynamic_cast<Object*>(this)->class_name().c_str());
+					as_object()->class_name().c_str());
 
 				__pycpp_error_out_of_bound(block_location);
 			}
@@ -335,7 +348,7 @@ namespace pycpp
 			{
 				char block_location[32];
 				std::sprintf(block_location, "%s::pop(i32 index)",
-					dynamic_cast<Object*>(this)->class_name().c_str());
+					as_object()->class_name().c_str());
 
 				__pycpp_error_out_of_bound(block_location);
 			}
@@ -343,8 +356,7 @@ namespace pycpp
 			if (index < 0)
 				index += len;
 
-			DEREF(data[index]);
-			SAFE(data[index]);
+			DECREF(data[index]);
 
 			for (i32 i = index + 1; i < len; ++i)
 				data[i - 1] = data[i];
@@ -353,21 +365,21 @@ namespace pycpp
 
 		void extend(Iterable* iterable)
 		{
-			auto arguments = dynamic_cast<Arguments*>(iterable);
+			auto arguments = as_arguments(iterable);
 			if (arguments)
 			{
 				extend_from_arguments(arguments);
 				return;
 			}
 
-			auto __array = dynamic_cast<__Array*>(iterable);
+			auto __array = as_array(iterable);
 			if (__array)
 			{
 				extend_from_array(__array);
 				return;
 			}
 
-			auto __hashtable = dynamic_cast<__HashTable*>(iterable);
+			auto __hashtable = as_hashtable(iterable);
 			if (__hashtable)
 			{
 				extend_from_hashtable(__hashtable);
@@ -394,6 +406,13 @@ namespace pycpp
 
 		#pragma region Private Methods
 
+		// Gọi "visit" với mỗi phần tử.
+		void traverse(TraverseVisitor visit, void* context)
+		{
+			for (u32 i = 0u; i < len; ++i)
+				visit(data[i], context);
+		}
+
 		void multiply_with_int(u32 multiplier)
 		{
 			if (len == 0u || multiplier == 1u)
@@ -410,7 +429,7 @@ namespace pycpp
 			{
 				char block_location[64];
 				std::sprintf(block_location, "%s::mul",
-					dynamic_cast<Object*>(this)->class_name().c_str());
+					as_object()->class_name().c_str());
 
 				__pycpp_error_out_of_bound(block_location);
 			}
@@ -440,7 +459,7 @@ namespace pycpp
 			{
 				char block_location[64];
 				std::sprintf(block_location, "%s::extend",
-					dynamic_cast<Object*>(this)->class_name().c_str());
+					as_object()->class_name().c_str());
 
 				__pycpp_error_out_of_bound(block_location);
 			}
@@ -471,7 +490,7 @@ namespace pycpp
 			{
 				char block_location[64];
 				std::sprintf(block_location, "%s::extend",
-					dynamic_cast<Object*>(this)->class_name().c_str());
+					as_object()->class_name().c_str());
 
 				__pycpp_error_out_of_bound(block_location);
 			}
@@ -501,25 +520,21 @@ namespace pycpp
 			{
 				char block_location[64];
 				std::sprintf(block_location, "%s::extend",
-					dynamic_cast<Object*>(this)->class_name().c_str());
+					as_object()->class_name().c_str());
 
 				__pycpp_error_out_of_bound(block_location);
 			}
 
-			Entry* head;
 			u32 increase_counter = 0u;
+			source->finish_rehash();
 			for (u32 i = 0u; i < source->capacity; ++i)
 			{
-				head = source;
-				if (head == nullptr)
+				if (source->is_full(i) == false)
 					continue;
 
-				for (; head; head = head->next)
-				{
-					INREF(head->ref);
-					data[increase_counter + len] = head->ref;
-					++increase_counter;
-				}
+				INREF(source->data[i].ref);
+				data[increase_counter + len] = source->data[i].ref;
+				++increase_counter;
 			}
 
 			len += source->len;
@@ -540,7 +555,7 @@ namespace pycpp
 			{
 				char block_location[64];
 				std::sprintf(block_location, "%s::extend",
-					dynamic_cast<Object*>(this)->class_name().c_str());
+					as_object()->class_name().c_str());
 
 				__pycpp_error_out_of_bound(block_location);
 			}
@@ -565,6 +580,14 @@ namespace pycpp
 
 	#pragma endregion
 
+	public:
+		// Trả về Object triển khai __FixedArray ( không tăng tham chiếu ).
+		virtual Object* as_object()
+		{
+			// Note : mọi class buộc phải kế thừa Object
+			return dynamic_cast<Object*>(this);
+		}
+
 	#pragma region Iterator
 	public:
 
@@ -582,18 +605,22 @@ namespace pycpp
 
 			~iterator()
 			{
-				DEREF(container);
-				SAFE(container);
+				DECREF(container);
 			}
 
 		public:
-			TYPE_ID(__FixedArray::iterator);
+			BUILTIN_TYPE_ID(FixedArrayIterator);
 
 			i64 type() override
 			{
 				return type_id;
 			}
 
+			Object* as_object() override
+			{
+				return this;
+			}
+
 			std::string class_name() override
 			{
 				return typeid(__FixedArray::iterator).name();
@@ -615,7 +642,7 @@ namespace pycpp
 				{
 					char block_location[64];
 					std::sprintf(block_location, "%s::iterator::next",
-						dynamic_cast<Object*>(container)->class_name().c_str());
+						container->as_object()->class_name().c_str());
 
 					__pycpp_error_out_of_bound(block_location);
 					return;
@@ -630,7 +657,7 @@ namespace pycpp
 				{
 					char block_location[64];
 					std::sprintf(block_location, "%s::iterator::prev",
-						dynamic_cast<Object*>(container)->class_name().c_str());
+						container->as_object()->class_name().c_str());
 
 					__pycpp_error_out_of_bound(block_location);
 					return;
@@ -645,7 +672,7 @@ namespace pycpp
 				{
 					char block_location[64];
 					std::sprintf(block_location, "%s::iterator::get",
-						dynamic_cast<Object*>(container)->class_name().c_str());
+						container->as_object()->class_name().c_str());
 
 					__pycpp_error_out_of_bound(block_location);
 					return nullptr;